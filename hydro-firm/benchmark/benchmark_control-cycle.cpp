@@ -0,0 +1,294 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../test/test_sensors/fixed-sensor.hpp"
+#include "allocation-counter.hpp"
+#include <ArduinoFake.h>
+#include <benchmark/benchmark.h>
+#include <data/process/process.hpp>
+#include <executor/executor.hpp>
+#include <memory>
+#include <sensors/moisture-level/moisture-level.hpp>
+#include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/sensor-set/sensor-set.hpp>
+#include <sensors/static-read-sensors/static-read-sensors.hpp>
+#include <sensors/water-level/water-level.hpp>
+#include <system/controller/controller.hpp>
+#include <system/process/process.hpp>
+#include <system/state/state.hpp>
+#include <system/zones/zones.hpp>
+#include <timing/virtual-clock/virtual-clock.hpp>
+#include <vector>
+
+namespace {
+
+const char *const BENCH_SENSOR = "Bench Sensor";
+const char *const LAST_BENCH_SENSOR = "Last Bench Sensor";
+const int BENCH_READING = 5;
+
+/*
+ * Water level and moisture sensors followed by bench sensors up to the given
+ * count. The last sensor has a type of its own, so looking it up by type walks
+ * the whole registry. Kept as a base class so that the sensors are registered before the
+ * state looks them up.
+ */
+struct NodeSensors {
+  std::vector<std::unique_ptr<FixedSensor>> sensorList;
+  Sensors::SensorSet<Sensors::MAX_SENSORS> sensors;
+
+  explicit NodeSensors(const uint8_t sensorCount) {
+    for (uint8_t index = 0; index < sensorCount; ++index) {
+      const char *type = index == 0                 ? Sensors::WATER_LEVEL_SENSOR
+                         : index == 1               ? Sensors::MOISTURE_LEVEL_SENSOR
+                         : index == sensorCount - 1 ? LAST_BENCH_SENSOR
+                                                    : BENCH_SENSOR;
+      this->sensorList.emplace_back(new FixedSensor(type, BENCH_READING, index));
+      this->sensors.add(*this->sensorList.back());
+    }
+  }
+};
+
+/*
+ * Everything a control cycle needs, running on a virtual clock
+ */
+struct Node : NodeSensors {
+  Timing::VirtualClock clock;
+  Sensors::ReadSensors readSensors;
+  System::State state;
+  System::Controller controller;
+  System::Process systemProcess;
+  Data::Process dataProcess;
+  MainExecutor::Executor executor;
+
+  explicit Node(const uint8_t sensorCount, const Sensors::READ_MODE readMode = Sensors::BATCHED)
+      : NodeSensors(sensorCount), readSensors(this->sensors, readMode, this->clock), state(this->readSensors),
+        controller(this->state), systemProcess(this->controller, this->state),
+        dataProcess(this->readSensors, this->clock),
+        executor(this->readSensors, this->systemProcess, this->dataProcess, this->clock) {}
+};
+
+/*
+ * Final stages, so the statically composed node calls them without virtual
+ * dispatch
+ */
+class BenchState final : public System::State {
+public:
+  using System::State::State;
+};
+
+class BenchController final : public System::Controller {
+public:
+  using System::Controller::Controller;
+};
+
+class BenchDataProcess final : public Data::Process {
+public:
+  using Data::Process::Process;
+};
+
+using StaticReadSensors = Sensors::StaticReadSensors<FixedSensor, FixedSensor>;
+using StaticSystemProcess = System::BasicProcess<BenchController, BenchState>;
+
+/*
+ * The control cycle of a two sensor Node composed at compile time
+ */
+struct StaticNode {
+  FixedSensor waterLevelSensor{Sensors::WATER_LEVEL_SENSOR, BENCH_READING, 0};
+  FixedSensor moistureLevelSensor{Sensors::MOISTURE_LEVEL_SENSOR, BENCH_READING, 1};
+  Timing::VirtualClock clock;
+  StaticReadSensors readSensors{this->waterLevelSensor, this->moistureLevelSensor, Sensors::BATCHED, this->clock};
+  BenchState state{this->readSensors};
+  BenchController controller{this->state};
+  StaticSystemProcess systemProcess{this->controller, this->state};
+  BenchDataProcess dataProcess{this->readSensors, this->clock};
+  MainExecutor::BasicExecutor<StaticReadSensors, StaticSystemProcess, BenchDataProcess, Timing::VirtualClock> executor{
+      this->readSensors, this->systemProcess, this->dataProcess, this->clock};
+};
+
+/*
+ * One read cycle over all sensors
+ */
+void BM_ReadAllSensors(benchmark::State &state) {
+  Node node(static_cast<uint8_t>(state.range(0)), static_cast<Sensors::READ_MODE>(state.range(1)));
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    node.readSensors.readAllSensors();
+    benchmark::DoNotOptimize(node.readSensors.getSequence());
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/*
+ * Look up the reading of the last registered sensor by its type name
+ */
+void BM_GetSensorReading(benchmark::State &state) {
+  Node node(static_cast<uint8_t>(state.range(0)));
+  node.readSensors.readAllSensors();
+  const char *type = node.sensorList.back()->getType();
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(node.readSensors.getSensorReading(type));
+  }
+  allocations.report(state);
+}
+
+/*
+ * Look up the reading of the last registered sensor by its identifier
+ */
+void BM_GetSensorReadingById(benchmark::State &state) {
+  const auto sensorCount = static_cast<uint8_t>(state.range(0));
+  Node node(sensorCount);
+  node.readSensors.readAllSensors();
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(node.readSensors.getSensorReadingById(sensorCount - 1));
+  }
+  allocations.report(state);
+}
+
+/*
+ * All predicates the control logic consults in one pass
+ */
+void BM_StatePredicates(benchmark::State &state) {
+  Node node(static_cast<uint8_t>(state.range(0)));
+  node.readSensors.readAllSensors();
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(node.state.isWaterLevelMax());
+    benchmark::DoNotOptimize(node.state.isWaterLevelMin());
+    benchmark::DoNotOptimize(node.state.isMoistureLevelMin());
+    benchmark::DoNotOptimize(node.state.getDecisionIndex());
+  }
+  allocations.report(state);
+}
+
+/*
+ * Control pass on readings published again without crossing a threshold, the
+ * steady state of the firmware, in which the decision logic is skipped. The
+ * read cycle publishing the readings is included, BM_ReadAllSensors gives its
+ * share.
+ */
+void BM_SystemProcessRun(benchmark::State &state) {
+  Node node(static_cast<uint8_t>(state.range(0)));
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    node.readSensors.readAllSensors();
+    node.systemProcess.run();
+  }
+  allocations.report(state);
+}
+
+/*
+ * Control pass without new readings, which is skipped
+ */
+void BM_SystemProcessRunUnchanged(benchmark::State &state) {
+  Node node(2);
+  node.readSensors.readAllSensors();
+  node.systemProcess.run();
+  node.systemProcess.run();
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    node.systemProcess.run();
+  }
+  allocations.report(state);
+  state.counters["skipped_passes"] = node.systemProcess.getSkippedPasses();
+}
+
+/*
+ * One executor loop per read period on the virtual clock, so read delays and
+ * idle time cost nothing. Every fourth loop also runs the data process.
+ */
+void BM_ExecutorLoop(benchmark::State &state) {
+  Node node(static_cast<uint8_t>(state.range(0)));
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    node.executor.loop();
+    node.clock.advance(MainExecutor::READ_SENSORS_PERIOD);
+  }
+  allocations.report(state);
+}
+
+/*
+ * One executor iteration of the statically composed node, to compare with
+ * BM_ExecutorLoop/sensors:2
+ */
+void BM_StaticExecutorLoop(benchmark::State &state) {
+  StaticNode node;
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    node.executor.loop();
+    node.clock.advance(MainExecutor::READ_SENSORS_PERIOD);
+  }
+  allocations.report(state);
+}
+
+/*
+ * Control pass over the given number of zones with two sensors each, on
+ * republished readings. The readings keep every zone filling, so after the
+ * first two passes no decision index changes and every pass is skipped after
+ * computing the index of each zone.
+ */
+void BM_ZonesRun(benchmark::State &state) {
+  const auto zoneCount = static_cast<uint8_t>(state.range(0));
+  NodeSensors sensors(static_cast<uint8_t>(2 * zoneCount));
+  Timing::VirtualClock clock;
+  Sensors::ReadSensors readSensors(sensors.sensors, Sensors::BATCHED, clock);
+  System::Zones zones(readSensors);
+  for (uint8_t zone = 0; zone < zoneCount; ++zone) {
+    const auto sensorId = static_cast<Sensors::SENSOR_ID>(2 * zone);
+    zones.addZone({sensorId, static_cast<Sensors::SENSOR_ID>(sensorId + 1), System::NO_OUTPUT_PIN,
+                   System::NO_OUTPUT_PIN});
+  }
+  readSensors.readAllSensors();
+  zones.run();
+  zones.run();
+  const AllocationCounter::Scope allocations;
+  for (auto _ : state) {
+    readSensors.readAllSensors();
+    zones.run();
+  }
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * zoneCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_ReadAllSensors)                                                                   // NOLINT
+    ->ArgsProduct({benchmark::CreateRange(2, 64, 2), {Sensors::SEQUENTIAL, Sensors::BATCHED}}) // NOLINT
+    ->ArgNames({"sensors", "batched"});                                                        // NOLINT
+BENCHMARK(BM_GetSensorReading)->RangeMultiplier(2)->Range(2, 64)->ArgName("sensors");          // NOLINT
+BENCHMARK(BM_GetSensorReadingById)->RangeMultiplier(2)->Range(2, 64)->ArgName("sensors");      // NOLINT
+BENCHMARK(BM_StatePredicates)->RangeMultiplier(2)->Range(2, 64)->ArgName("sensors");           // NOLINT
+BENCHMARK(BM_SystemProcessRun)->RangeMultiplier(2)->Range(2, 64)->ArgName("sensors");          // NOLINT
+BENCHMARK(BM_SystemProcessRunUnchanged);                                                       // NOLINT
+BENCHMARK(BM_ExecutorLoop)->RangeMultiplier(2)->Range(2, 64)->ArgName("sensors");              // NOLINT
+BENCHMARK(BM_StaticExecutorLoop);                                                              // NOLINT
+BENCHMARK(BM_ZonesRun)->RangeMultiplier(2)->Range(1, 32)->ArgName("zones");                    // NOLINT
@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <sensors/filter/filter.hpp>
+
+namespace {
+
+// Noisy ADC burst around mid scale, long enough for the largest sample count
+const std::array<int16_t, Sensors::MAX_SAMPLE_COUNT> NOISY_SAMPLES = {
+    {512, 498, 1023, 505, 0, 510, 507, 502, 509, 515, 496, 501, 511, 3, 506, 504}};
+
+/*
+ * Filter one burst per iteration and report the cost per sample
+ */
+void benchmarkFilter(benchmark::State &state, const Sensors::FILTER_TYPE filterType) {
+  const auto count = static_cast<uint8_t>(state.range(0));
+  std::array<int16_t, Sensors::MAX_SAMPLE_COUNT> samples = {};
+  for (auto _ : state) {
+    samples = NOISY_SAMPLES;
+    benchmark::DoNotOptimize(samples);
+    benchmark::DoNotOptimize(Sensors::filterSamples(filterType, samples.data(), count));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  state.counters["time_per_sample"] = benchmark::Counter(static_cast<double>(state.iterations()) * count,
+                                                         benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+void BM_FilterMean(benchmark::State &state) { benchmarkFilter(state, Sensors::MEAN); }
+void BM_FilterMedian(benchmark::State &state) { benchmarkFilter(state, Sensors::MEDIAN); }
+void BM_FilterTrimmedMean(benchmark::State &state) { benchmarkFilter(state, Sensors::TRIMMED_MEAN); }
+
+} // namespace
+
+BENCHMARK(BM_FilterMean)->Arg(1)->Arg(4)->Arg(9)->Arg(Sensors::MAX_SAMPLE_COUNT);        // NOLINT
+BENCHMARK(BM_FilterMedian)->Arg(1)->Arg(4)->Arg(9)->Arg(Sensors::MAX_SAMPLE_COUNT);      // NOLINT
+BENCHMARK(BM_FilterTrimmedMean)->Arg(1)->Arg(4)->Arg(9)->Arg(Sensors::MAX_SAMPLE_COUNT); // NOLINT
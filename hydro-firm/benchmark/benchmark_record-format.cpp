@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <telemetry/record-decoder/record-decoder.hpp>
+#include <telemetry/record-format/record-format.hpp>
+#include <telemetry/uplink/uplink.hpp>
+#include <vector>
+
+namespace {
+
+const uint32_t SAMPLE_PERIOD = 1000;
+const Sensors::SENSOR_ID SENSOR_COUNT = 2;
+
+/*
+ * Fill batches of the uplink size with readings of two sensors of the given
+ * noise, returning them as one stream
+ */
+auto encodeStream(const int noise, const size_t batchCount, uint64_t &samples) -> std::vector<uint8_t> {
+  std::vector<uint8_t> stream;
+  std::vector<uint8_t> batch(Telemetry::TELEMETRY_BATCH_SIZE);
+  Telemetry::RecordEncoder encoder(batch.data(), batch.size());
+  uint32_t timestamp = 0;
+  uint32_t random = 1;
+  samples = 0;
+  while (stream.size() < batchCount * Telemetry::TELEMETRY_BATCH_SIZE) {
+    timestamp += SAMPLE_PERIOD;
+    for (Sensors::SENSOR_ID sensorId = 0; sensorId < SENSOR_COUNT; ++sensorId) {
+      random = random * 1664525U + 1013904223U;
+      const int step = noise == 0 ? 0 : static_cast<int>((random >> 16U) % (2U * noise + 1U)) - noise;
+      const int value = 500 + 100 * sensorId + step;
+      if (!encoder.append(sensorId, timestamp, value)) {
+        const size_t length = encoder.finish();
+        stream.insert(stream.end(), batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(length));
+        encoder.clear();
+        encoder.append(sensorId, timestamp, value);
+      }
+      ++samples;
+    }
+  }
+  samples -= encoder.getRecordCount();
+  return stream;
+}
+
+/*
+ * Encode readings of the given noise and report the encoded size
+ */
+void BM_RecordEncode(benchmark::State &state) {
+  const auto noise = static_cast<int>(state.range(0));
+  std::vector<uint8_t> batch(Telemetry::TELEMETRY_BATCH_SIZE);
+  Telemetry::RecordEncoder encoder(batch.data(), batch.size());
+  uint32_t timestamp = 0;
+  uint32_t random = 1;
+  uint64_t samples = 0;
+  uint64_t bytes = 0;
+  for (auto _ : state) {
+    timestamp += SAMPLE_PERIOD;
+    random = random * 1664525U + 1013904223U;
+    const int step = noise == 0 ? 0 : static_cast<int>((random >> 16U) % (2U * noise + 1U)) - noise;
+    if (!encoder.append(0, timestamp, 500 + step)) {
+      samples += encoder.getRecordCount();
+      bytes += encoder.finish();
+      encoder.clear();
+      encoder.append(0, timestamp, 500 + step);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  if (samples > 0) {
+    state.counters["bytes_per_sample"] = static_cast<double>(bytes) / static_cast<double>(samples);
+  }
+}
+
+/*
+ * Decode a stream of full batches in network sized chunks
+ */
+void BM_RecordDecode(benchmark::State &state) {
+  const auto chunkSize = static_cast<size_t>(state.range(0));
+  uint64_t samples = 0;
+  const std::vector<uint8_t> stream = encodeStream(2, 64, samples);
+  Telemetry::Record record = {};
+  for (auto _ : state) {
+    Telemetry::RecordDecoder decoder;
+    for (size_t chunk = 0; chunk < stream.size(); chunk += chunkSize) {
+      const size_t end = std::min(stream.size(), chunk + chunkSize);
+      size_t offset = chunk;
+      while (offset < end) {
+        size_t consumed = 0;
+        benchmark::DoNotOptimize(decoder.next(&stream[offset], end - offset, record, consumed));
+        offset += consumed;
+      }
+    }
+    benchmark::DoNotOptimize(record);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * samples));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+  state.counters["bytes_per_sample"] = static_cast<double>(stream.size()) / static_cast<double>(samples);
+}
+
+} // namespace
+
+BENCHMARK(BM_RecordEncode)->Arg(0)->Arg(2)->Arg(64); // NOLINT
+BENCHMARK(BM_RecordDecode)->Arg(64)->Arg(1460);      // NOLINT
@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <data/log-storage/log-storage.hpp>
+#include <data/sample-log/sample-log.hpp>
+
+namespace {
+
+const uint32_t SAMPLE_PERIOD = 1000;
+const char *const LOG_PATH = "benchmark-sample-log.log";
+const uint32_t LOG_PAGE_COUNT = 1024;
+
+// Bytes taken by a reading stored as a raw timestamp and value
+const double RAW_SAMPLE_SIZE = sizeof(uint32_t) + sizeof(int16_t);
+
+/*
+ * Reading of a slowly drifting sensor with the given noise amplitude. The
+ * period jitters by a millisecond now and then, like the scheduler does.
+ */
+void nextSample(uint32_t &timestamp, int16_t &value, const int noise, uint32_t &state) {
+  state = state * 1664525U + 1013904223U;
+  timestamp += SAMPLE_PERIOD + ((state >> 28U) == 0 ? 1 : 0);
+  const int step = noise == 0 ? 0 : static_cast<int>((state >> 16U) % (2U * noise + 1U)) - noise;
+  value = static_cast<int16_t>(500 + ((timestamp / 600000U) % 50U) + step);
+}
+
+/*
+ * Fill pages with readings of the given noise and report the compressed size
+ */
+void BM_SampleLogEncode(benchmark::State &state) {
+  const auto noise = static_cast<int>(state.range(0));
+  Data::PageEncoder encoder;
+  uint32_t timestamp = 0;
+  int16_t value = 0;
+  uint32_t random = 1;
+  uint64_t samples = 0;
+  uint64_t bytes = 0;
+  nextSample(timestamp, value, noise, random);
+  encoder.start(0, timestamp, value);
+  for (auto _ : state) {
+    nextSample(timestamp, value, noise, random);
+    if (!encoder.append(timestamp, value)) {
+      samples += encoder.getSampleCount();
+      bytes += Data::LOG_PAGE_SIZE;
+      benchmark::DoNotOptimize(encoder.finish(1));
+      encoder.start(0, timestamp, value);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  if (samples > 0) {
+    const double bytesPerSample = static_cast<double>(bytes) / static_cast<double>(samples);
+    state.counters["bytes_per_sample"] = bytesPerSample;
+    state.counters["compression_ratio"] = RAW_SAMPLE_SIZE / bytesPerSample;
+  }
+}
+
+/*
+ * Record readings of two sensors into a file backed log and report the write
+ * throughput
+ */
+void BM_SampleLogWrite(benchmark::State &state) {
+  Data::FileLogStorage storage(LOG_PATH, LOG_PAGE_COUNT);
+  storage.erase();
+  Data::SampleLog sampleLog(storage);
+  sampleLog.begin();
+  uint32_t timestamp = 0;
+  int16_t value = 0;
+  uint32_t random = 1;
+  for (auto _ : state) {
+    nextSample(timestamp, value, 2, random);
+    sampleLog.record(0, timestamp, value);
+    sampleLog.record(1, timestamp, value / 2);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2);
+  state.counters["pages_written"] = sampleLog.getWrittenPages();
+  state.SetBytesProcessed(static_cast<int64_t>(sampleLog.getWrittenPages() * Data::LOG_PAGE_SIZE));
+  storage.erase();
+}
+
+} // namespace
+
+BENCHMARK(BM_SampleLogEncode)->Arg(0)->Arg(2)->Arg(8)->Arg(64); // NOLINT
+BENCHMARK(BM_SampleLogWrite);                                   // NOLINT
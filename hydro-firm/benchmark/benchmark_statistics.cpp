@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <data/statistics/statistics.hpp>
+
+namespace {
+
+// Slowly drifting ADC readings with noise, repeated over the benchmark
+const std::array<int16_t, 16> READINGS = {
+    {512, 498, 530, 505, 470, 510, 507, 540, 509, 515, 496, 501, 511, 480, 506, 504}};
+
+/*
+ * Update the statistics with one reading per iteration
+ */
+template <typename Statistics> void benchmarkUpdate(benchmark::State &state) {
+  Statistics statistics;
+  size_t index = 0;
+  for (auto _ : state) {
+    statistics.update(READINGS[index]);
+    index = (index + 1) % READINGS.size();
+    benchmark::DoNotOptimize(statistics);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+void BM_EwmaUpdate(benchmark::State &state) { benchmarkUpdate<Data::Ewma>(state); }
+void BM_RunningVarianceUpdate(benchmark::State &state) { benchmarkUpdate<Data::RunningVariance>(state); }
+void BM_SensorStatisticsUpdate(benchmark::State &state) { benchmarkUpdate<Data::SensorStatistics>(state); }
+
+/*
+ * The cost per update of the moving extremes should not depend on the window
+ * length
+ */
+template <uint16_t N> void BM_MovingExtremesUpdate(benchmark::State &state) {
+  benchmarkUpdate<Data::MovingExtremes<N>>(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_EwmaUpdate);                          // NOLINT
+BENCHMARK(BM_RunningVarianceUpdate);               // NOLINT
+BENCHMARK(BM_SensorStatisticsUpdate);              // NOLINT
+BENCHMARK_TEMPLATE(BM_MovingExtremesUpdate, 8);    // NOLINT
+BENCHMARK_TEMPLATE(BM_MovingExtremesUpdate, 64);   // NOLINT
+BENCHMARK_TEMPLATE(BM_MovingExtremesUpdate, 512);  // NOLINT
+BENCHMARK_TEMPLATE(BM_MovingExtremesUpdate, 4096); // NOLINT
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <telemetry/loopback/loopback.hpp>
+#include <telemetry/uplink/uplink.hpp>
+#include <vector>
+
+namespace {
+
+const uint32_t SAMPLE_PERIOD = 1000;
+
+/*
+ * Send readings of the given number of sensors through the loopback server,
+ * draining it as a consumer would, and report the writes saved by batching
+ */
+void BM_UplinkThroughput(benchmark::State &state) {
+  const auto sensorCount = static_cast<Sensors::SENSOR_ID>(state.range(0));
+  Telemetry::LoopbackTransport transport;
+  Telemetry::Uplink uplink(transport);
+  std::vector<uint8_t> batch;
+  uint32_t timestamp = 0;
+  for (auto _ : state) {
+    timestamp += SAMPLE_PERIOD;
+    for (Sensors::SENSOR_ID sensorId = 0; sensorId < sensorCount; ++sensorId) {
+      uplink.record(sensorId, timestamp, static_cast<int>(500 + sensorId));
+    }
+    while (transport.receive(batch)) {
+      benchmark::DoNotOptimize(batch.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * sensorCount);
+  state.SetBytesProcessed(static_cast<int64_t>(transport.getReceivedBytes()));
+  if (uplink.getSentBatches() > 0) {
+    state.counters["samples_per_write"] =
+        static_cast<double>(uplink.getSentSamples()) / static_cast<double>(uplink.getSentBatches());
+  }
+}
+
+/*
+ * Keep sending readings while the server never drains its queue, measuring
+ * the cost of a dropped reading
+ */
+void BM_UplinkBackpressure(benchmark::State &state) {
+  Telemetry::LoopbackTransport transport(1);
+  Telemetry::Uplink uplink(transport);
+  uint32_t timestamp = 0;
+  for (auto _ : state) {
+    timestamp += SAMPLE_PERIOD;
+    benchmark::DoNotOptimize(uplink.record(0, timestamp, 500));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  state.counters["dropped_samples"] = uplink.getDroppedSamples();
+}
+
+} // namespace
+
+BENCHMARK(BM_UplinkThroughput)->Arg(1)->Arg(2); // NOLINT
+BENCHMARK(BM_UplinkBackpressure);               // NOLINT
@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/bit-stream/bit-stream.hpp>
+
+namespace {
+
+const uint8_t BYTE_BITS = 8;
+const uint8_t HIGHEST_BIT = 0x80;
+
+} // namespace
+
+/*
+ * Map a signed value to an unsigned one with small codes for small magnitudes
+ */
+auto Data::zigZagEncode(const int32_t value) -> uint32_t {
+  return (static_cast<uint32_t>(value) << 1U) ^ static_cast<uint32_t>(value >> 31); // NOLINT(hicpp-signed-bitwise)
+}
+
+/*
+ * Reverse of zigZagEncode()
+ */
+auto Data::zigZagDecode(const uint32_t value) -> int32_t {
+  return static_cast<int32_t>((value >> 1U) ^ (~(value & 1U) + 1U));
+}
+
+/*
+ * Constructor
+ */
+Data::BitWriter::BitWriter(uint8_t *buffer, const size_t capacity)
+    : buffer(buffer), capacityBits(capacity * BYTE_BITS) {}
+
+/*
+ * Write the lowest bits of the value, most significant bit first
+ */
+auto Data::BitWriter::write(const uint32_t value, const uint8_t bits) -> bool {
+  if (bits > this->getRemaining()) {
+    return false;
+  }
+  for (uint8_t bit = bits; bit > 0; --bit) {
+    const auto mask = static_cast<uint8_t>(HIGHEST_BIT >> (this->position % BYTE_BITS));
+    uint8_t &byte = this->buffer[this->position / BYTE_BITS]; // NOLINT(cppcoreguidelines-pro-bounds-*)
+    if (((value >> (bit - 1U)) & 1U) != 0) {
+      byte |= mask;
+    } else {
+      byte &= static_cast<uint8_t>(~mask);
+    }
+    ++this->position;
+  }
+  return true;
+}
+
+/*
+ * Get the number of bits written
+ */
+auto Data::BitWriter::getPosition() const -> size_t { return this->position; }
+
+/*
+ * Move back to a previous position
+ */
+void Data::BitWriter::rewind(const size_t bitPosition) {
+  if (bitPosition < this->position) {
+    this->position = bitPosition;
+  }
+}
+
+/*
+ * Get the number of bits that can still be written
+ */
+auto Data::BitWriter::getRemaining() const -> size_t { return this->capacityBits - this->position; }
+
+/*
+ * Constructor
+ */
+Data::BitReader::BitReader(const uint8_t *buffer, const size_t capacity)
+    : buffer(buffer), capacityBits(capacity * BYTE_BITS) {}
+
+/*
+ * Read a value of the given number of bits, most significant bit first
+ */
+auto Data::BitReader::read(const uint8_t bits, uint32_t &value) -> bool {
+  if (bits > this->capacityBits - this->position) {
+    return false;
+  }
+  value = 0;
+  for (uint8_t bit = 0; bit < bits; ++bit) {
+    const auto mask = static_cast<uint8_t>(HIGHEST_BIT >> (this->position % BYTE_BITS));
+    const uint8_t byte = this->buffer[this->position / BYTE_BITS]; // NOLINT(cppcoreguidelines-pro-bounds-*)
+    value = (value << 1U) | ((byte & mask) != 0 ? 1U : 0U);
+    ++this->position;
+  }
+  return true;
+}
@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef DATA_BIT_STREAM_BIT_STREAM_HPP
+#define DATA_BIT_STREAM_BIT_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Data {
+
+/*
+ * Map a signed value to an unsigned one so that values close to zero, both
+ * positive and negative, get small codes: 0, -1, 1, -2, ... map to 0, 1, 2, 3.
+ */
+auto zigZagEncode(int32_t value) -> uint32_t;
+
+/*
+ * Reverse of zigZagEncode()
+ */
+auto zigZagDecode(uint32_t value) -> int32_t;
+
+/*
+ * Writes values of up to 32 bits into a byte buffer, most significant bit
+ * first.
+ */
+class BitWriter {
+
+private:
+  uint8_t *const buffer;
+  const size_t capacityBits;
+  size_t position = 0;
+
+public:
+  /*
+   * Constructor for a writer filling the given buffer from its start
+   */
+  explicit BitWriter(uint8_t *buffer, size_t capacity);
+
+  /*
+   * Write the lowest bits of the value. Returns false, leaving the stream
+   * unchanged, if the value does not fit in the buffer.
+   */
+  auto write(uint32_t value, uint8_t bits) -> bool;
+
+  /*
+   * Get the number of bits written
+   */
+  auto getPosition() const -> size_t;
+
+  /*
+   * Move back to a previous position, dropping the bits written after it
+   */
+  void rewind(size_t bitPosition);
+
+  /*
+   * Get the number of bits that can still be written
+   */
+  auto getRemaining() const -> size_t;
+};
+
+/*
+ * Reads values written by a BitWriter.
+ */
+class BitReader {
+
+private:
+  const uint8_t *const buffer;
+  const size_t capacityBits;
+  size_t position = 0;
+
+public:
+  /*
+   * Constructor for a reader starting at the beginning of the buffer
+   */
+  explicit BitReader(const uint8_t *buffer, size_t capacity);
+
+  /*
+   * Read a value of the given number of bits. Returns false if the buffer
+   * ends before the value.
+   */
+  auto read(uint8_t bits, uint32_t &value) -> bool;
+};
+
+} // namespace Data
+
+#endif
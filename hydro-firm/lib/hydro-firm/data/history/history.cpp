@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <algorithm>
+#include <data/history/history.hpp>
+
+/*
+ * Add the value to the accumulator, completing the previous period first if
+ * the timestamp falls in a new one.
+ */
+auto Data::SensorHistory::accumulate(Accumulator &accumulator, const uint32_t periodLength, const uint32_t timestamp,
+                                     const int16_t value, Aggregate &completed) -> bool {
+  const uint32_t period = timestamp / periodLength;
+  bool isCompleted = false;
+  if (accumulator.count > 0 && accumulator.period != period) {
+    completed.timestamp = accumulator.period * periodLength;
+    completed.minimum = accumulator.minimum;
+    completed.maximum = accumulator.maximum;
+    completed.mean = static_cast<int16_t>(accumulator.sum / accumulator.count);
+    accumulator.count = 0;
+    isCompleted = true;
+  }
+
+  if (accumulator.count == 0) {
+    accumulator.period = period;
+    accumulator.sum = 0;
+    accumulator.minimum = value;
+    accumulator.maximum = value;
+  }
+  accumulator.sum += value;
+  accumulator.minimum = std::min(accumulator.minimum, value);
+  accumulator.maximum = std::max(accumulator.maximum, value);
+  ++accumulator.count;
+  return isCompleted;
+}
+
+/*
+ * Record a reading taken at the given time
+ */
+void Data::SensorHistory::record(const uint32_t timestamp, const int16_t value) {
+  this->raw.push({timestamp, value});
+
+  Aggregate completed = {};
+  if (accumulate(this->minuteAccumulator, MINUTE_MILLIS, timestamp, value, completed)) {
+    this->minutes.push(completed);
+  }
+  if (accumulate(this->hourAccumulator, HOUR_MILLIS, timestamp, value, completed)) {
+    this->hours.push(completed);
+  }
+}
+
+/*
+ * Get the raw samples, oldest first
+ */
+auto Data::SensorHistory::getRaw() const -> const RingBuffer<Sample, RAW_HISTORY_LENGTH> & { return this->raw; }
+
+/*
+ * Get the completed one minute aggregates, oldest first
+ */
+auto Data::SensorHistory::getMinutes() const -> const RingBuffer<Aggregate, MINUTE_HISTORY_LENGTH> & {
+  return this->minutes;
+}
+
+/*
+ * Get the completed one hour aggregates, oldest first
+ */
+auto Data::SensorHistory::getHours() const -> const RingBuffer<Aggregate, HOUR_HISTORY_LENGTH> & {
+  return this->hours;
+}
+
+/*
+ * Record a reading of the sensor with the given identifier. Readings are ADC
+ * values and fit in 16 bits.
+ */
+auto Data::History::record(const Sensors::SENSOR_ID sensorId, const uint32_t timestamp, const int sensorReading)
+    -> bool {
+  if (sensorId >= MAX_HISTORY_SENSORS) {
+    return false;
+  }
+  this->sensorHistories[sensorId].record(timestamp, static_cast<int16_t>(sensorReading));
+  return true;
+}
+
+/*
+ * Get the history of the sensor with the given identifier
+ */
+auto Data::History::getSensorHistory(const Sensors::SENSOR_ID sensorId) const -> const SensorHistory * {
+  return sensorId < MAX_HISTORY_SENSORS ? &this->sensorHistories[sensorId] : nullptr;
+}
@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef DATA_HISTORY_HISTORY_HPP
+#define DATA_HISTORY_HISTORY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <data/ring-buffer/ring-buffer.hpp>
+#include <sensors/sensor.hpp>
+
+namespace Data {
+
+// Length of the aggregation periods, in milliseconds
+const uint32_t MINUTE_MILLIS = 60000UL;
+const uint32_t HOUR_MILLIS = 3600000UL;
+
+// Number of raw samples kept per sensor, two minutes at one sample per second
+const uint16_t RAW_HISTORY_LENGTH = 120;
+
+// Number of one minute aggregates kept per sensor, two hours
+const uint16_t MINUTE_HISTORY_LENGTH = 120;
+
+// Number of one hour aggregates kept per sensor, two days
+const uint16_t HOUR_HISTORY_LENGTH = 48;
+
+// Number of sensors with a history, statistics and a sample log page, set at
+// build time with -D HISTORY_SENSORS=<count> for nodes with more sensors.
+// Sensors with a higher identifier are not recorded.
+#ifndef HISTORY_SENSORS
+#define HISTORY_SENSORS 2
+#endif
+const uint8_t MAX_HISTORY_SENSORS = HISTORY_SENSORS;
+
+// Upper limit for the memory used by the history of one sensor, and of all
+// sensors, in bytes
+const size_t SENSOR_HISTORY_MEMORY_BUDGET = 4096;
+const size_t HISTORY_MEMORY_BUDGET = SENSOR_HISTORY_MEMORY_BUDGET * MAX_HISTORY_SENSORS;
+
+/*
+ * Reading of a sensor at a point in time
+ */
+struct Sample {
+  uint32_t timestamp;
+  int16_t value;
+};
+
+/*
+ * Summary of the readings of a sensor over one aggregation period. The
+ * timestamp is the start of the period.
+ */
+struct Aggregate {
+  uint32_t timestamp;
+  int16_t minimum;
+  int16_t maximum;
+  int16_t mean;
+};
+
+/*
+ * History of a single sensor. Keeps the latest raw samples along with minute
+ * and hour aggregates, each tier in a ring buffer of fixed length.
+ */
+class SensorHistory {
+
+private:
+  struct Accumulator {
+    // Index of the aggregation period being accumulated
+    uint32_t period;
+    int32_t sum;
+    int16_t minimum;
+    int16_t maximum;
+    uint16_t count;
+  };
+
+  RingBuffer<Sample, RAW_HISTORY_LENGTH> raw;
+  RingBuffer<Aggregate, MINUTE_HISTORY_LENGTH> minutes;
+  RingBuffer<Aggregate, HOUR_HISTORY_LENGTH> hours;
+  Accumulator minuteAccumulator = {};
+  Accumulator hourAccumulator = {};
+
+  /*
+   * Add the value to the accumulator. If the timestamp falls in a new period
+   * the previous period is completed into the given aggregate first, in which
+   * case true is returned.
+   */
+  static auto accumulate(Accumulator &accumulator, uint32_t periodLength, uint32_t timestamp, int16_t value,
+                         Aggregate &completed) -> bool;
+
+public:
+  /*
+   * Record a reading taken at the given time
+   */
+  void record(uint32_t timestamp, int16_t value);
+
+  /*
+   * Get the raw samples, oldest first
+   */
+  auto getRaw() const -> const RingBuffer<Sample, RAW_HISTORY_LENGTH> &;
+
+  /*
+   * Get the completed one minute aggregates, oldest first
+   */
+  auto getMinutes() const -> const RingBuffer<Aggregate, MINUTE_HISTORY_LENGTH> &;
+
+  /*
+   * Get the completed one hour aggregates, oldest first
+   */
+  auto getHours() const -> const RingBuffer<Aggregate, HOUR_HISTORY_LENGTH> &;
+};
+
+/*
+ * History of all recorded sensors, indexed by the sensor identifier.
+ */
+class History {
+
+private:
+  std::array<SensorHistory, MAX_HISTORY_SENSORS> sensorHistories = {};
+
+public:
+  /*
+   * Record a reading of the sensor with the given identifier. Returns false if
+   * the sensor has no history.
+   */
+  auto record(Sensors::SENSOR_ID sensorId, uint32_t timestamp, int sensorReading) -> bool;
+
+  /*
+   * Get the history of the sensor with the given identifier. Returns nullptr
+   * if the sensor has no history.
+   */
+  auto getSensorHistory(Sensors::SENSOR_ID sensorId) const -> const SensorHistory *;
+};
+
+// Memory used by the history of all sensors, in bytes
+constexpr size_t HISTORY_MEMORY_SIZE = sizeof(History);
+
+static_assert(HISTORY_MEMORY_SIZE <= HISTORY_MEMORY_BUDGET, "History exceeds its memory budget");
+
+} // namespace Data
+
+#endif
@@ -0,0 +1,255 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/log-storage/log-storage.hpp>
+
+#include <cstdio>
+
+/*
+ * Constructor
+ */
+Data::FileLogStorage::FileLogStorage(const char *path, const uint32_t pageCount, const uint32_t segmentPageCount)
+    : path(path), pageCount(pageCount), segmentPageCount(segmentPageCount) {}
+
+/*
+ * Destructor, closes the open file
+ */
+Data::FileLogStorage::~FileLogStorage() { this->closeSegmentFile(); }
+
+/*
+ * Get the number of page slots
+ */
+auto Data::FileLogStorage::getPageCount() const -> uint32_t { return this->pageCount; }
+
+/*
+ * Write the path of the segment file to the buffer. Paths too long for the
+ * buffer are cut short.
+ */
+void Data::FileLogStorage::formatSegmentPath(const uint32_t segment,
+                                             std::array<char, MAX_LOG_PATH_LENGTH> &segmentPath) const {
+  std::snprintf(segmentPath.data(), segmentPath.size(), "%s.%u", this->path, static_cast<unsigned>(segment));
+}
+
+/*
+ * Open the file of the slot and move to the slot in it. Writing the first
+ * slot of a segment starts its file anew.
+ */
+auto Data::FileLogStorage::seekSlot(const uint32_t slot, const bool isWrite) -> bool {
+  if (!this->isAvailable || slot >= this->pageCount) {
+    return false;
+  }
+  const uint32_t segment = slot / this->segmentPageCount;
+  const uint32_t offset = slot % this->segmentPageCount;
+  const bool isOpen =
+      isWrite && offset == 0 ? this->truncateSegmentFile(segment) : this->openSegmentFile(segment, isWrite);
+  return isOpen && this->seekFile(offset * LOG_PAGE_SIZE);
+}
+
+/*
+ * Delete every segment file
+ */
+void Data::FileLogStorage::erase() {
+  this->closeSegmentFile();
+  std::array<char, MAX_LOG_PATH_LENGTH> segmentPath = {};
+  const uint32_t segmentCount = (this->pageCount + this->segmentPageCount - 1) / this->segmentPageCount;
+  for (uint32_t segment = 0; segment < segmentCount; ++segment) {
+    this->formatSegmentPath(segment, segmentPath);
+#ifdef NATIVE
+    std::remove(segmentPath.data());
+#else
+    LittleFS.remove(segmentPath.data());
+#endif
+  }
+}
+
+#ifdef NATIVE
+
+/*
+ * Open the first segment, creating it if it does not exist
+ */
+auto Data::FileLogStorage::begin() -> bool {
+  this->isAvailable = true;
+  this->isAvailable = this->openSegmentFile(0, true);
+  return this->isAvailable;
+}
+
+/*
+ * Open the file of the segment unless it is open already
+ */
+auto Data::FileLogStorage::openSegmentFile(const uint32_t segment, const bool create) -> bool {
+  if (this->file != nullptr && this->openSegment == segment) {
+    return true;
+  }
+  this->closeSegmentFile();
+  std::array<char, MAX_LOG_PATH_LENGTH> segmentPath = {};
+  this->formatSegmentPath(segment, segmentPath);
+  this->file = std::fopen(segmentPath.data(), "r+b"); // NOLINT(cppcoreguidelines-owning-memory)
+  if (this->file == nullptr && create) {
+    this->file = std::fopen(segmentPath.data(), "w+b"); // NOLINT(cppcoreguidelines-owning-memory)
+  }
+  this->openSegment = segment;
+  return this->file != nullptr;
+}
+
+/*
+ * Open the file of the segment emptied
+ */
+auto Data::FileLogStorage::truncateSegmentFile(const uint32_t segment) -> bool {
+  this->closeSegmentFile();
+  std::array<char, MAX_LOG_PATH_LENGTH> segmentPath = {};
+  this->formatSegmentPath(segment, segmentPath);
+  this->file = std::fopen(segmentPath.data(), "w+b"); // NOLINT(cppcoreguidelines-owning-memory)
+  this->openSegment = segment;
+  return this->file != nullptr;
+}
+
+/*
+ * Close the open file, if any
+ */
+void Data::FileLogStorage::closeSegmentFile() {
+  if (this->file != nullptr) {
+    std::fclose(this->file); // NOLINT(cppcoreguidelines-owning-memory)
+    this->file = nullptr;
+  }
+}
+
+/*
+ * Move the position in the open file
+ */
+auto Data::FileLogStorage::seekFile(const uint32_t position) -> bool {
+  return std::fseek(this->file, static_cast<long>(position), SEEK_SET) == 0;
+}
+
+/*
+ * Write a page to the given slot
+ */
+auto Data::FileLogStorage::writePage(const uint32_t slot, const uint8_t *page) -> bool {
+  if (!this->seekSlot(slot, true)) {
+    return false;
+  }
+  const size_t written = std::fwrite(page, 1, LOG_PAGE_SIZE, this->file);
+  return std::fflush(this->file) == 0 && written == LOG_PAGE_SIZE; // LCOV_EXCL_BR_LINE
+}
+
+/*
+ * Read a page from the given slot
+ */
+auto Data::FileLogStorage::readPage(const uint32_t slot, uint8_t *page) -> bool {
+  if (!this->seekSlot(slot, false)) {
+    return false;
+  }
+  return std::fread(page, 1, LOG_PAGE_SIZE, this->file) == LOG_PAGE_SIZE;
+}
+
+#else
+
+/*
+ * Mount LittleFS and open the first segment, creating it if it does not
+ * exist. A log left in the single file of earlier firmware is removed, as
+ * the segments need its space.
+ */
+auto Data::FileLogStorage::begin() -> bool {
+  if (!LittleFS.begin()) {
+    return false;
+  }
+  LittleFS.remove(this->path);
+  this->isAvailable = true;
+  this->isAvailable = this->openSegmentFile(0, true);
+  return this->isAvailable;
+}
+
+/*
+ * Open the file of the segment unless it is open already
+ */
+auto Data::FileLogStorage::openSegmentFile(const uint32_t segment, const bool create) -> bool {
+  if (this->file && this->openSegment == segment) {
+    return true;
+  }
+  this->closeSegmentFile();
+  std::array<char, MAX_LOG_PATH_LENGTH> segmentPath = {};
+  this->formatSegmentPath(segment, segmentPath);
+  const bool exists = LittleFS.exists(segmentPath.data());
+  if (!exists && !create) {
+    return false;
+  }
+  this->file = LittleFS.open(segmentPath.data(), exists ? "r+" : "w+");
+  this->openSegment = segment;
+  return static_cast<bool>(this->file);
+}
+
+/*
+ * Open the file of the segment emptied
+ */
+auto Data::FileLogStorage::truncateSegmentFile(const uint32_t segment) -> bool {
+  this->closeSegmentFile();
+  std::array<char, MAX_LOG_PATH_LENGTH> segmentPath = {};
+  this->formatSegmentPath(segment, segmentPath);
+  this->file = LittleFS.open(segmentPath.data(), "w+");
+  this->openSegment = segment;
+  return static_cast<bool>(this->file);
+}
+
+/*
+ * Close the open file, if any
+ */
+void Data::FileLogStorage::closeSegmentFile() {
+  if (this->file) {
+    this->file.close();
+  }
+}
+
+/*
+ * Move the position in the open file
+ */
+auto Data::FileLogStorage::seekFile(const uint32_t position) -> bool { return this->file.seek(position, SeekSet); }
+
+/*
+ * Write a page to the given slot
+ */
+auto Data::FileLogStorage::writePage(const uint32_t slot, const uint8_t *page) -> bool {
+  if (!this->seekSlot(slot, true)) {
+    return false;
+  }
+  const bool isWritten = this->file.write(page, LOG_PAGE_SIZE) == LOG_PAGE_SIZE;
+  this->file.flush();
+  return isWritten;
+}
+
+/*
+ * Read a page from the given slot
+ */
+auto Data::FileLogStorage::readPage(const uint32_t slot, uint8_t *page) -> bool {
+  if (!this->seekSlot(slot, false)) {
+    return false;
+  }
+  return this->file.read(page, LOG_PAGE_SIZE) == LOG_PAGE_SIZE;
+}
+
+#endif
@@ -0,0 +1,190 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef DATA_LOG_STORAGE_LOG_STORAGE_HPP
+#define DATA_LOG_STORAGE_LOG_STORAGE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef NATIVE
+#include <cstdio>
+#else
+#include <LittleFS.h>
+#endif
+
+namespace Data {
+
+// Size of a log page in bytes, a multiple of the flash page size
+const size_t LOG_PAGE_SIZE = 256;
+
+/*
+ * Storage for a fixed number of log pages, addressed by slot.
+ */
+class LogStorage {
+
+public:
+  virtual ~LogStorage() = default;
+
+  /*
+   * Prepare the storage for reading and writing. Returns false if the storage
+   * is not available.
+   */
+  virtual auto begin() -> bool = 0;
+
+  /*
+   * Get the number of page slots
+   */
+  virtual auto getPageCount() const -> uint32_t = 0;
+
+  /*
+   * Write LOG_PAGE_SIZE bytes to the given slot
+   */
+  virtual auto writePage(uint32_t slot, const uint8_t *page) -> bool = 0;
+
+  /*
+   * Read LOG_PAGE_SIZE bytes from the given slot. Returns false if the slot
+   * was never written.
+   */
+  virtual auto readPage(uint32_t slot, uint8_t *page) -> bool = 0;
+};
+
+// Pages per segment file of a FileLogStorage, 16 KiB
+const uint32_t LOG_SEGMENT_PAGE_COUNT = 64;
+
+// Longest path of a segment file including the terminating null, the
+// LittleFS name limit
+const size_t MAX_LOG_PATH_LENGTH = 32;
+
+/*
+ * Log storage in a row of segment files of segmentPageCount slots each, named
+ * after the given path with the segment number appended. Pages are only ever
+ * appended to a segment; writing the first slot of a segment starts the file
+ * anew, dropping the oldest segmentPageCount pages at once. Rewriting a slot
+ * in the middle of one large file would make LittleFS copy everything after
+ * it, as its files are copy-on-write. Backed by LittleFS on the board and by
+ * regular files on the native build.
+ */
+class FileLogStorage : public LogStorage {
+
+private:
+  const char *const path;
+  const uint32_t pageCount;
+  const uint32_t segmentPageCount;
+  // Set by begin(), pages are only read and written after it
+  bool isAvailable = false;
+  // Segment of the open file
+  uint32_t openSegment = 0;
+#ifdef NATIVE
+  std::FILE *file = nullptr;
+#else
+  File file;
+#endif
+
+  /*
+   * Write the path of the segment file to the buffer
+   */
+  void formatSegmentPath(uint32_t segment, std::array<char, MAX_LOG_PATH_LENGTH> &segmentPath) const;
+
+  /*
+   * Open the file of the segment unless it is open already. A missing file
+   * is created if create is set. Returns false if the file is not available.
+   */
+  auto openSegmentFile(uint32_t segment, bool create) -> bool;
+
+  /*
+   * Open the file of the segment emptied
+   */
+  auto truncateSegmentFile(uint32_t segment) -> bool;
+
+  /*
+   * Close the open file, if any
+   */
+  void closeSegmentFile();
+
+  /*
+   * Move the position in the open file
+   */
+  auto seekFile(uint32_t position) -> bool;
+
+  /*
+   * Open the file of the slot and move to the slot in it. Returns false if
+   * the storage is not available or the slot is out of range.
+   */
+  auto seekSlot(uint32_t slot, bool isWrite) -> bool;
+
+public:
+  /*
+   * Constructor for a storage of pageCount slots in segment files named after
+   * the given path
+   */
+  explicit FileLogStorage(const char *path, uint32_t pageCount,
+                          uint32_t segmentPageCount = LOG_SEGMENT_PAGE_COUNT);
+
+  FileLogStorage(const FileLogStorage &) = delete;
+  auto operator=(const FileLogStorage &) -> FileLogStorage & = delete;
+
+  /*
+   * Destructor, closes the open file
+   */
+  ~FileLogStorage() override;
+
+  /*
+   * Prepare the file system and the first segment, creating it if it does
+   * not exist
+   */
+  auto begin() -> bool override;
+
+  /*
+   * Delete every segment file. On the board the file system has to be
+   * mounted by begin() first.
+   */
+  void erase();
+
+  /*
+   * Get the number of page slots
+   */
+  auto getPageCount() const -> uint32_t override;
+
+  /*
+   * Write a page to the given slot
+   */
+  auto writePage(uint32_t slot, const uint8_t *page) -> bool override;
+
+  /*
+   * Read a page from the given slot
+   */
+  auto readPage(uint32_t slot, uint8_t *page) -> bool override;
+};
+
+} // namespace Data
+
+#endif
@@ -34,9 +34,58 @@
 /*
  * Constructor
  */
-Data::Process::Process() = default;
+Data::Process::Process(const Sensors::ReadSensors &readSensors, const Timing::Clock &clock)
+    : readSensors(&readSensors), clock(&clock) {}
 
 /*
- * Run the system processes.
+ * Pass every processed reading to the given sink as well
  */
-void Data::Process::run() const {}
+auto Data::Process::addSampleSink(SampleSink &sampleSink) -> bool {
+  if (this->sampleSinkCount >= MAX_SAMPLE_SINKS) {
+    return false;
+  }
+  this->sampleSinks[this->sampleSinkCount] = &sampleSink;
+  ++this->sampleSinkCount;
+  return true;
+}
+
+/*
+ * Run the system processes. Records the readings of the latest snapshot in
+ * the sensor history and the sample sinks, and updates the running
+ * statistics.
+ */
+void Data::Process::run() {
+  const Sensors::ReadingSnapshot &snapshot = this->readSensors->getAllSensorReading();
+  if (snapshot.sequence == this->processedSequence) {
+    return;
+  }
+  this->processedSequence = snapshot.sequence;
+
+  const uint32_t timestamp = this->clock->millis();
+  for (Sensors::SENSOR_ID sensorId = 0; sensorId < snapshot.count; ++sensorId) {
+    const int sensorReading = snapshot.getReading(sensorId);
+    if (this->history.record(sensorId, timestamp, sensorReading)) {
+      this->statistics[sensorId].update(static_cast<int16_t>(sensorReading));
+    }
+    for (uint8_t sink = 0; sink < this->sampleSinkCount; ++sink) {
+      this->sampleSinks[sink]->record(sensorId, timestamp, sensorReading);
+    }
+  }
+}
+
+/*
+ * Get the sequence of the last reading snapshot processed
+ */
+auto Data::Process::getProcessedSequence() const -> uint32_t { return this->processedSequence; }
+
+/*
+ * Get the history of the sensor readings
+ */
+auto Data::Process::getHistory() const -> const History & { return this->history; }
+
+/*
+ * Get the running statistics of the sensor with the given identifier
+ */
+auto Data::Process::getStatistics(const Sensors::SENSOR_ID sensorId) const -> const SensorStatistics * {
+  return sensorId < MAX_HISTORY_SENSORS ? &this->statistics[sensorId] : nullptr;
+}
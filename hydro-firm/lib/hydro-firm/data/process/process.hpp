@@ -32,21 +32,68 @@
 #ifndef DATA_PROCESS_PROCESS_HPP
 #define DATA_PROCESS_PROCESS_HPP
 
-#include <memory>
+#include <array>
+#include <cstdint>
+#include <data/history/history.hpp>
+#include <data/sample-sink/sample-sink.hpp>
+#include <data/statistics/statistics.hpp>
+#include <sensors/read-sensors/read-sensors.hpp>
+#include <timing/clock/clock.hpp>
+#include <timing/hardware-clock/hardware-clock.hpp>
 
 namespace Data {
+
+// Maximum number of sample sinks fed by the process
+const uint8_t MAX_SAMPLE_SINKS = 4;
+
 class Process {
 private:
+  const Sensors::ReadSensors *readSensors;
+  // Clock the readings are timestamped with
+  const Timing::Clock *clock;
+  // Sequence of the last reading snapshot processed
+  uint32_t processedSequence = 0;
+  History history;
+  // Running statistics of the sensors with a history
+  std::array<SensorStatistics, MAX_HISTORY_SENSORS> statistics = {};
+  // Consumers of the readings, such as the sample log
+  std::array<SampleSink *, MAX_SAMPLE_SINKS> sampleSinks = {};
+  uint8_t sampleSinkCount = 0;
+
 public:
   /*
    * Constructor
    */
-  explicit Process();
+  explicit Process(const Sensors::ReadSensors &readSensors,
+                   const Timing::Clock &clock = Timing::getHardwareClock());
+
+  /*
+   * Pass every processed reading to the given sink as well. Returns false if
+   * MAX_SAMPLE_SINKS sinks were added already.
+   */
+  auto addSampleSink(SampleSink &sampleSink) -> bool;
+
+  /*
+   * Process the system data. Does nothing if no new reading snapshot was
+   * published since the last run.
+   */
+  virtual auto run() -> void;
+
+  /*
+   * Get the sequence of the last reading snapshot processed
+   */
+  auto getProcessedSequence() const -> uint32_t;
+
+  /*
+   * Get the history of the sensor readings
+   */
+  auto getHistory() const -> const History &;
 
   /*
-   * Process the system data
+   * Get the running statistics of the sensor with the given identifier.
+   * Returns nullptr if no statistics are kept for the sensor.
    */
-  virtual auto run() const -> void;
+  auto getStatistics(Sensors::SENSOR_ID sensorId) const -> const SensorStatistics *;
 };
 
 } // namespace Data
@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef DATA_RING_BUFFER_RING_BUFFER_HPP
+#define DATA_RING_BUFFER_RING_BUFFER_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace Data {
+
+/*
+ * Fixed-capacity ring buffer. Once full, pushing an item overwrites the oldest
+ * one. Items are indexed from the oldest to the newest.
+ */
+template <typename T, uint16_t N> class RingBuffer {
+  static_assert(N > 0, "RingBuffer capacity must be greater than zero");
+
+private:
+  std::array<T, N> items = {};
+  // Index of the slot the next item is written to
+  uint16_t head = 0;
+  uint16_t count = 0;
+
+public:
+  /*
+   * Add an item, overwriting the oldest one if the buffer is full
+   */
+  void push(const T &item) {
+    this->items[this->head] = item;
+    this->head = static_cast<uint16_t>((this->head + 1) % N);
+    if (this->count < N) {
+      ++this->count;
+    }
+  }
+
+  /*
+   * Get the item at the given position, zero being the oldest item
+   */
+  auto operator[](uint16_t index) const -> const T & {
+    return this->items[(this->head + N - this->count + index) % N];
+  }
+
+  /*
+   * Get the newest item. The buffer must not be empty.
+   */
+  auto latest() const -> const T & { return this->items[(this->head + N - 1) % N]; }
+
+  /*
+   * Get the number of items in the buffer
+   */
+  auto size() const -> uint16_t { return this->count; }
+
+  /*
+   * Get the maximum number of items in the buffer
+   */
+  static constexpr auto capacity() -> uint16_t { return N; }
+
+  /*
+   * Remove all items
+   */
+  void clear() {
+    this->head = 0;
+    this->count = 0;
+  }
+};
+
+} // namespace Data
+
+#endif
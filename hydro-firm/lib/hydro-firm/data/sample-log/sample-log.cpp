@@ -0,0 +1,334 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/sample-log/sample-log.hpp>
+
+namespace {
+
+// Offsets of the header fields, multi byte fields are little endian
+const size_t MAGIC_OFFSET = 0;
+const size_t VERSION_OFFSET = 1;
+const size_t SENSOR_ID_OFFSET = 2;
+const size_t SEQUENCE_OFFSET = 4;
+const size_t TIMESTAMP_OFFSET = 8;
+const size_t VALUE_OFFSET = 12;
+const size_t COUNT_OFFSET = 14;
+
+const size_t PAYLOAD_SIZE = Data::LOG_PAGE_SIZE - Data::LOG_PAGE_HEADER_SIZE;
+
+const uint8_t BYTE_BITS = 8;
+const uint8_t BYTE_MASK = 0xFF;
+
+// Payload bits of each prefix code. Code n is n one bits followed by a zero
+// bit, the last code omits the zero bit. Code zero stands for a zero value.
+const uint8_t TIMESTAMP_CODE_COUNT = 5;
+const std::array<uint8_t, TIMESTAMP_CODE_COUNT> TIMESTAMP_CODE_BITS = {{0, 7, 9, 12, 32}};
+const uint8_t VALUE_CODE_COUNT = 4;
+const std::array<uint8_t, VALUE_CODE_COUNT> VALUE_CODE_BITS = {{0, 4, 8, 17}};
+
+/*
+ * Store the lowest bytes of the value at the given offset
+ */
+void putBytes(uint8_t *page, const size_t offset, const uint32_t value, const uint8_t bytes) {
+  for (uint8_t index = 0; index < bytes; ++index) {
+    page[offset + index] = static_cast<uint8_t>((value >> (index * BYTE_BITS)) & BYTE_MASK); // NOLINT
+  }
+}
+
+/*
+ * Load a value of the given number of bytes from the given offset
+ */
+auto getBytes(const uint8_t *page, const size_t offset, const uint8_t bytes) -> uint32_t {
+  uint32_t value = 0;
+  for (uint8_t index = 0; index < bytes; ++index) {
+    value |= static_cast<uint32_t>(page[offset + index]) << (index * BYTE_BITS); // NOLINT
+  }
+  return value;
+}
+
+/*
+ * Write the value with the shortest prefix code it fits in
+ */
+template <size_t N>
+auto writeCoded(Data::BitWriter &writer, const uint32_t value, const std::array<uint8_t, N> &codeBits) -> bool {
+  uint8_t code = 0;
+  while (code < N - 1 && static_cast<uint64_t>(value) >= (1ULL << codeBits[code])) {
+    ++code;
+  }
+  const uint32_t ones = (1UL << code) - 1;
+  const bool isLastCode = code == N - 1;
+  const bool isPrefixWritten = isLastCode ? writer.write(ones, code) : writer.write(ones << 1U, code + 1);
+  return isPrefixWritten && writer.write(value, codeBits[code]);
+}
+
+/*
+ * Read a value written by writeCoded()
+ */
+template <size_t N>
+auto readCoded(Data::BitReader &reader, uint32_t &value, const std::array<uint8_t, N> &codeBits) -> bool {
+  uint8_t code = 0;
+  uint32_t bit = 1;
+  while (code < N - 1 && bit == 1) {
+    if (!reader.read(1, bit)) {
+      return false;
+    }
+    code = static_cast<uint8_t>(code + bit);
+  }
+  return reader.read(codeBits[code], value);
+}
+
+} // namespace
+
+/*
+ * Constructor
+ */
+Data::PageEncoder::PageEncoder() : writer(page.data() + LOG_PAGE_HEADER_SIZE, PAYLOAD_SIZE) {}
+
+/*
+ * Start a new page with the given first sample
+ */
+void Data::PageEncoder::start(const Sensors::SENSOR_ID pageSensorId, const uint32_t timestamp, const int16_t value) {
+  this->writer.rewind(0);
+  this->sensorId = pageSensorId;
+  this->sampleCount = 1;
+  this->previousTimestamp = timestamp;
+  this->previousDelta = 0;
+  this->previousValue = value;
+  putBytes(this->page.data(), TIMESTAMP_OFFSET, timestamp, 4);
+  putBytes(this->page.data(), VALUE_OFFSET, static_cast<uint16_t>(value), 2);
+}
+
+/*
+ * Add a sample to the page
+ */
+auto Data::PageEncoder::append(const uint32_t timestamp, const int16_t value) -> bool {
+  const size_t position = this->writer.getPosition();
+  const auto delta = static_cast<int32_t>(timestamp - this->previousTimestamp);
+  // Differences wrap around like the millis() timestamps do
+  const uint32_t timestampCode =
+      zigZagEncode(static_cast<int32_t>(static_cast<uint32_t>(delta) - static_cast<uint32_t>(this->previousDelta)));
+  const uint32_t valueCode = zigZagEncode(static_cast<int32_t>(value) - this->previousValue);
+  if (!writeCoded(this->writer, timestampCode, TIMESTAMP_CODE_BITS) ||
+      !writeCoded(this->writer, valueCode, VALUE_CODE_BITS)) {
+    this->writer.rewind(position);
+    return false;
+  }
+  ++this->sampleCount;
+  this->previousTimestamp = timestamp;
+  this->previousDelta = delta;
+  this->previousValue = value;
+  return true;
+}
+
+/*
+ * Complete the header and get the page
+ */
+auto Data::PageEncoder::finish(const uint32_t sequence) -> const uint8_t * {
+  uint8_t *header = this->page.data();
+  header[MAGIC_OFFSET] = LOG_PAGE_MAGIC;       // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  header[VERSION_OFFSET] = LOG_FORMAT_VERSION; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  header[SENSOR_ID_OFFSET] = this->sensorId;   // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  putBytes(header, SEQUENCE_OFFSET, sequence, 4);
+  putBytes(header, COUNT_OFFSET, this->sampleCount, 2);
+  return header;
+}
+
+/*
+ * Drop the samples of the page
+ */
+void Data::PageEncoder::clear() {
+  this->writer.rewind(0);
+  this->sampleCount = 0;
+}
+
+/*
+ * Get the number of samples in the page
+ */
+auto Data::PageEncoder::getSampleCount() const -> uint16_t { return this->sampleCount; }
+
+/*
+ * Get the number of bytes used by the header and the samples
+ */
+auto Data::PageEncoder::getEncodedSize() const -> size_t {
+  return LOG_PAGE_HEADER_SIZE + (this->writer.getPosition() + BYTE_BITS - 1) / BYTE_BITS;
+}
+
+/*
+ * Constructor
+ */
+Data::PageDecoder::PageDecoder(const uint8_t *page)
+    : page(page), reader(page + LOG_PAGE_HEADER_SIZE, PAYLOAD_SIZE) { // NOLINT
+  if (this->isValid()) {
+    this->remaining = this->getSampleCount();
+  }
+}
+
+/*
+ * Checks if the page holds samples in a supported format
+ */
+auto Data::PageDecoder::isValid() const -> bool {
+  return this->page[MAGIC_OFFSET] == LOG_PAGE_MAGIC &&     // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         this->page[VERSION_OFFSET] == LOG_FORMAT_VERSION; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/*
+ * Get the identifier of the sensor of the samples
+ */
+auto Data::PageDecoder::getSensorId() const -> Sensors::SENSOR_ID {
+  return this->page[SENSOR_ID_OFFSET]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/*
+ * Get the sequence number of the page
+ */
+auto Data::PageDecoder::getSequence() const -> uint32_t { return getBytes(this->page, SEQUENCE_OFFSET, 4); }
+
+/*
+ * Get the number of samples in the page
+ */
+auto Data::PageDecoder::getSampleCount() const -> uint16_t {
+  return static_cast<uint16_t>(getBytes(this->page, COUNT_OFFSET, 2));
+}
+
+/*
+ * Read the next sample
+ */
+auto Data::PageDecoder::next(Sample &sample) -> bool {
+  if (this->remaining == 0) {
+    return false;
+  }
+  if (this->first) {
+    this->first = false;
+    this->previousTimestamp = getBytes(this->page, TIMESTAMP_OFFSET, 4);
+    this->previousValue = static_cast<int16_t>(getBytes(this->page, VALUE_OFFSET, 2));
+  } else {
+    uint32_t timestampCode = 0;
+    uint32_t valueCode = 0;
+    if (!readCoded(this->reader, timestampCode, TIMESTAMP_CODE_BITS) ||
+        !readCoded(this->reader, valueCode, VALUE_CODE_BITS)) {
+      this->remaining = 0;
+      return false;
+    }
+    const auto deltaOfDelta = static_cast<uint32_t>(zigZagDecode(timestampCode));
+    this->previousDelta = static_cast<int32_t>(static_cast<uint32_t>(this->previousDelta) + deltaOfDelta);
+    this->previousTimestamp += static_cast<uint32_t>(this->previousDelta);
+    this->previousValue = static_cast<int16_t>(this->previousValue + zigZagDecode(valueCode));
+  }
+  --this->remaining;
+  sample.timestamp = this->previousTimestamp;
+  sample.value = this->previousValue;
+  return true;
+}
+
+/*
+ * Constructor
+ */
+Data::SampleLog::SampleLog(LogStorage &storage) : storage(&storage) {}
+
+/*
+ * Prepare the storage and continue after the newest page already in it
+ */
+auto Data::SampleLog::begin() -> bool {
+  if (!this->storage->begin()) {
+    return false;
+  }
+  std::array<uint8_t, LOG_PAGE_SIZE> page = {};
+  uint32_t newestSequence = 0;
+  for (uint32_t slot = 0; slot < this->storage->getPageCount(); ++slot) {
+    if (!this->storage->readPage(slot, page.data())) {
+      break;
+    }
+    const PageDecoder decoder(page.data());
+    if (decoder.isValid() && decoder.getSequence() > newestSequence) {
+      newestSequence = decoder.getSequence();
+      this->nextSlot = (slot + 1) % this->storage->getPageCount();
+    }
+  }
+  this->nextSequence = newestSequence + 1;
+  this->writtenPages = newestSequence;
+  return true;
+}
+
+/*
+ * Write the page of the encoder to the next slot
+ */
+auto Data::SampleLog::writePage(PageEncoder &encoder) -> bool {
+  if (!this->storage->writePage(this->nextSlot, encoder.finish(this->nextSequence))) {
+    return false;
+  }
+  this->nextSlot = (this->nextSlot + 1) % this->storage->getPageCount();
+  ++this->nextSequence;
+  ++this->writtenPages;
+  return true;
+}
+
+/*
+ * Record a reading of the sensor with the given identifier
+ */
+auto Data::SampleLog::record(const Sensors::SENSOR_ID sensorId, const uint32_t timestamp, const int sensorReading)
+    -> bool {
+  if (sensorId >= MAX_HISTORY_SENSORS) {
+    return false;
+  }
+  PageEncoder &encoder = this->encoders[sensorId];
+  const auto value = static_cast<int16_t>(sensorReading);
+  if (encoder.getSampleCount() > 0 && encoder.append(timestamp, value)) {
+    return true;
+  }
+  // A page that cannot be written is dropped, so the log keeps going with the
+  // next page once the storage recovers
+  const bool isWritten = encoder.getSampleCount() == 0 || this->writePage(encoder);
+  encoder.start(sensorId, timestamp, value);
+  return isWritten;
+}
+
+/*
+ * Write the pages which are not full yet
+ */
+auto Data::SampleLog::flush() -> bool {
+  bool isWritten = true;
+  for (auto &encoder : this->encoders) {
+    if (encoder.getSampleCount() > 0) {
+      isWritten = this->writePage(encoder) && isWritten;
+      encoder.clear();
+    }
+  }
+  return isWritten;
+}
+
+/*
+ * Get the slot the next page is written to
+ */
+auto Data::SampleLog::getNextSlot() const -> uint32_t { return this->nextSlot; }
+
+/*
+ * Get the number of pages written since the log was created
+ */
+auto Data::SampleLog::getWrittenPages() const -> uint32_t { return this->writtenPages; }
@@ -0,0 +1,217 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef DATA_SAMPLE_LOG_SAMPLE_LOG_HPP
+#define DATA_SAMPLE_LOG_SAMPLE_LOG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <data/bit-stream/bit-stream.hpp>
+#include <data/history/history.hpp>
+#include <data/log-storage/log-storage.hpp>
+#include <data/sample-sink/sample-sink.hpp>
+#include <sensors/sensor.hpp>
+
+namespace Data {
+
+// Marker of a written log page, erased flash reads as 0xFF or 0x00
+const uint8_t LOG_PAGE_MAGIC = 0xA5;
+
+// Version of the page format
+const uint8_t LOG_FORMAT_VERSION = 1;
+
+// Size of the page header holding the first sample in full
+const size_t LOG_PAGE_HEADER_SIZE = 16;
+
+/*
+ * Builds a log page of samples of a single sensor. The first sample is kept
+ * in the header. Each further sample stores the delta of delta of its
+ * timestamp and the zig-zag encoded delta of its value, with a prefix code
+ * choosing the number of bits, so a steady 1 Hz reading of an unchanged value
+ * costs two bits.
+ */
+class PageEncoder {
+
+private:
+  std::array<uint8_t, LOG_PAGE_SIZE> page = {};
+  BitWriter writer;
+  Sensors::SENSOR_ID sensorId = Sensors::INVALID_SENSOR_ID;
+  uint16_t sampleCount = 0;
+  uint32_t previousTimestamp = 0;
+  int32_t previousDelta = 0;
+  int16_t previousValue = 0;
+
+public:
+  /*
+   * Constructor for an empty page
+   */
+  explicit PageEncoder();
+
+  PageEncoder(const PageEncoder &) = delete;
+  auto operator=(const PageEncoder &) -> PageEncoder & = delete;
+
+  /*
+   * Start a new page with the given first sample
+   */
+  void start(Sensors::SENSOR_ID pageSensorId, uint32_t timestamp, int16_t value);
+
+  /*
+   * Add a sample to the page. Returns false, leaving the page unchanged, if
+   * the sample does not fit.
+   */
+  auto append(uint32_t timestamp, int16_t value) -> bool;
+
+  /*
+   * Complete the header with the page sequence and sample count and get the
+   * page of LOG_PAGE_SIZE bytes
+   */
+  auto finish(uint32_t sequence) -> const uint8_t *;
+
+  /*
+   * Drop the samples of the page
+   */
+  void clear();
+
+  /*
+   * Get the number of samples in the page, zero if the page was not started
+   */
+  auto getSampleCount() const -> uint16_t;
+
+  /*
+   * Get the number of bytes used by the header and the samples
+   */
+  auto getEncodedSize() const -> size_t;
+};
+
+/*
+ * Reads the samples of a page built by a PageEncoder.
+ */
+class PageDecoder {
+
+private:
+  const uint8_t *const page;
+  BitReader reader;
+  uint16_t remaining = 0;
+  uint32_t previousTimestamp = 0;
+  int32_t previousDelta = 0;
+  int16_t previousValue = 0;
+  bool first = true;
+
+public:
+  /*
+   * Constructor for a decoder of the given page of LOG_PAGE_SIZE bytes
+   */
+  explicit PageDecoder(const uint8_t *page);
+
+  /*
+   * Checks if the page holds samples in a supported format
+   */
+  auto isValid() const -> bool;
+
+  /*
+   * Get the identifier of the sensor of the samples
+   */
+  auto getSensorId() const -> Sensors::SENSOR_ID;
+
+  /*
+   * Get the sequence number of the page
+   */
+  auto getSequence() const -> uint32_t;
+
+  /*
+   * Get the number of samples in the page
+   */
+  auto getSampleCount() const -> uint16_t;
+
+  /*
+   * Read the next sample. Returns false once all samples were read.
+   */
+  auto next(Sample &sample) -> bool;
+};
+
+/*
+ * Append-only compressed log of sensor readings. Readings are collected in
+ * one page per sensor in memory and a page is written to storage once it is
+ * full, so flash is written one page at a time. Slots are reused in a circle,
+ * overwriting the oldest page when the storage is full.
+ */
+class SampleLog : public SampleSink {
+
+private:
+  LogStorage *storage;
+  std::array<PageEncoder, MAX_HISTORY_SENSORS> encoders;
+  uint32_t nextSlot = 0;
+  uint32_t nextSequence = 1;
+  uint32_t writtenPages = 0;
+
+  /*
+   * Write the page of the encoder to the next slot
+   */
+  auto writePage(PageEncoder &encoder) -> bool;
+
+public:
+  /*
+   * Constructor
+   */
+  explicit SampleLog(LogStorage &storage);
+
+  /*
+   * Prepare the storage and continue after the newest page already in it.
+   * Returns false if the storage is not available.
+   */
+  auto begin() -> bool;
+
+  /*
+   * Record a reading of the sensor with the given identifier. Returns false if
+   * the sensor is not logged or a full page could not be written.
+   */
+  auto record(Sensors::SENSOR_ID sensorId, uint32_t timestamp, int sensorReading) -> bool override;
+
+  /*
+   * Write the pages which are not full yet. Uses a slot per page, so it is
+   * meant for an orderly shutdown only.
+   */
+  auto flush() -> bool;
+
+  /*
+   * Get the slot the next page is written to
+   */
+  auto getNextSlot() const -> uint32_t;
+
+  /*
+   * Get the number of pages written since the log was created
+   */
+  auto getWrittenPages() const -> uint32_t;
+};
+
+} // namespace Data
+
+#endif
@@ -0,0 +1,139 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/statistics/statistics.hpp>
+
+namespace {
+
+// Half of the least significant integer bit, used for rounding
+const int32_t ROUNDING = 1 << (Data::FRACTION_BITS - 1);
+
+/*
+ * Convert a fixed-point value to the nearest integer
+ */
+auto toInteger(const int32_t value) -> int16_t {
+  return static_cast<int16_t>((value + ROUNDING) >> Data::FRACTION_BITS); // NOLINT(hicpp-signed-bitwise)
+}
+
+} // namespace
+
+/*
+ * Add a sample to the average. The shift of a negative difference relies on
+ * an arithmetic right shift, as done by all supported compilers.
+ */
+void Data::Ewma::update(const int16_t value) {
+  const int32_t sample = static_cast<int32_t>(value) * (1 << FRACTION_BITS);
+  if (!this->initialised) {
+    this->average = sample;
+    this->initialised = true;
+    return;
+  }
+  this->average += (sample - this->average) >> EWMA_SHIFT; // NOLINT(hicpp-signed-bitwise)
+}
+
+/*
+ * Get the average rounded to the nearest integer
+ */
+auto Data::Ewma::getAverage() const -> int16_t { return toInteger(this->average); }
+
+/*
+ * Add a sample to the statistics. The part of the mean update which the
+ * division drops is carried to the next update, so the mean still follows
+ * the samples once the count makes every single update smaller than one
+ * fixed-point step.
+ */
+void Data::RunningVariance::update(const int16_t value) {
+  const int32_t sample = static_cast<int32_t>(value) * (1 << FRACTION_BITS);
+  ++this->count;
+  const int32_t delta = sample - this->mean;
+  const int64_t change = this->meanRemainder + delta;
+  this->mean += static_cast<int32_t>(change / this->count);
+  this->meanRemainder = change % this->count;
+  this->squaredDifferences += static_cast<int64_t>(delta) * (sample - this->mean);
+}
+
+/*
+ * Get the number of samples
+ */
+auto Data::RunningVariance::getCount() const -> uint32_t { return this->count; }
+
+/*
+ * Get the mean rounded to the nearest integer
+ */
+auto Data::RunningVariance::getMean() const -> int16_t { return toInteger(this->mean); }
+
+/*
+ * Get the population variance rounded down to an integer
+ */
+auto Data::RunningVariance::getVariance() const -> int32_t {
+  if (this->count == 0) {
+    return 0;
+  }
+  return static_cast<int32_t>((this->squaredDifferences / this->count) >> (2 * FRACTION_BITS)); // NOLINT
+}
+
+/*
+ * Add a reading to all statistics
+ */
+void Data::SensorStatistics::update(const int16_t value) {
+  this->ewma.update(value);
+  this->runningVariance.update(value);
+  this->extremes.update(value);
+}
+
+/*
+ * Get the exponentially weighted moving average
+ */
+auto Data::SensorStatistics::getEwma() const -> int16_t { return this->ewma.getAverage(); }
+
+/*
+ * Get the mean of all readings
+ */
+auto Data::SensorStatistics::getMean() const -> int16_t { return this->runningVariance.getMean(); }
+
+/*
+ * Get the variance of all readings
+ */
+auto Data::SensorStatistics::getVariance() const -> int32_t { return this->runningVariance.getVariance(); }
+
+/*
+ * Get the minimum over the last EXTREMES_WINDOW_LENGTH readings
+ */
+auto Data::SensorStatistics::getMinimum() const -> int16_t { return this->extremes.getMinimum(); }
+
+/*
+ * Get the maximum over the last EXTREMES_WINDOW_LENGTH readings
+ */
+auto Data::SensorStatistics::getMaximum() const -> int16_t { return this->extremes.getMaximum(); }
+
+/*
+ * Get the number of readings
+ */
+auto Data::SensorStatistics::getCount() const -> uint32_t { return this->runningVariance.getCount(); }
@@ -0,0 +1,223 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef DATA_STATISTICS_STATISTICS_HPP
+#define DATA_STATISTICS_STATISTICS_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace Data {
+
+// Number of fractional bits of the fixed-point statistics
+const uint8_t FRACTION_BITS = 8;
+
+// Smoothing factor of the moving average as a power of two, 3 gives 1/8
+const uint8_t EWMA_SHIFT = 3;
+
+// Number of samples the minimum and maximum are tracked over, one minute at
+// one sample per second
+const uint16_t EXTREMES_WINDOW_LENGTH = 60;
+
+/*
+ * Exponentially weighted moving average in fixed-point. The first sample
+ * initialises the average.
+ */
+class Ewma {
+
+private:
+  int32_t average = 0;
+  bool initialised = false;
+
+public:
+  /*
+   * Add a sample to the average
+   */
+  void update(int16_t value);
+
+  /*
+   * Get the average rounded to the nearest integer
+   */
+  auto getAverage() const -> int16_t;
+};
+
+/*
+ * Running mean and variance using Welford's algorithm in fixed-point, so the
+ * variance is accurate without keeping a sum of squares.
+ */
+class RunningVariance {
+
+private:
+  uint32_t count = 0;
+  int32_t mean = 0;
+  // Sum of the samples minus count * mean, less than count in magnitude
+  int64_t meanRemainder = 0;
+  // Sum of squared differences from the mean, with 2 * FRACTION_BITS
+  // fractional bits
+  int64_t squaredDifferences = 0;
+
+public:
+  /*
+   * Add a sample to the statistics
+   */
+  void update(int16_t value);
+
+  /*
+   * Get the number of samples
+   */
+  auto getCount() const -> uint32_t;
+
+  /*
+   * Get the mean rounded to the nearest integer
+   */
+  auto getMean() const -> int16_t;
+
+  /*
+   * Get the population variance rounded down to an integer
+   */
+  auto getVariance() const -> int32_t;
+};
+
+/*
+ * Minimum and maximum over the last N samples. Each bound is kept as a
+ * monotonic wedge of candidates, so an update costs amortised constant time
+ * irrespective of N.
+ */
+template <uint16_t N> class MovingExtremes {
+  static_assert(N > 0, "MovingExtremes window must be greater than zero");
+
+private:
+  struct Candidate {
+    // Position of the sample in the stream of samples
+    uint32_t index;
+    int16_t value;
+  };
+
+  struct Wedge {
+    std::array<Candidate, N> candidates;
+    uint16_t front;
+    uint16_t count;
+  };
+
+  Wedge minimumWedge = {};
+  Wedge maximumWedge = {};
+  uint32_t sampleCount = 0;
+
+  /*
+   * Drop the candidates which left the window from the front, and those that
+   * can no longer be the bound from the back, then append the sample.
+   */
+  template <typename Compare> void push(Wedge &wedge, const int16_t value, Compare isBetter) {
+    while (wedge.count > 0 && this->sampleCount - wedge.candidates[wedge.front].index >= N) {
+      wedge.front = static_cast<uint16_t>((wedge.front + 1) % N);
+      --wedge.count;
+    }
+    while (wedge.count > 0 && !isBetter(wedge.candidates[(wedge.front + wedge.count - 1) % N].value, value)) {
+      --wedge.count;
+    }
+    wedge.candidates[(wedge.front + wedge.count) % N] = {this->sampleCount, value};
+    ++wedge.count;
+  }
+
+public:
+  /*
+   * Add a sample to the window
+   */
+  void update(const int16_t value) {
+    this->push(this->minimumWedge, value, [](int16_t candidate, int16_t sample) { return candidate < sample; });
+    this->push(this->maximumWedge, value, [](int16_t candidate, int16_t sample) { return candidate > sample; });
+    ++this->sampleCount;
+  }
+
+  /*
+   * Get the minimum of the window. Zero if no sample was added.
+   */
+  auto getMinimum() const -> int16_t {
+    return this->minimumWedge.count > 0 ? this->minimumWedge.candidates[this->minimumWedge.front].value : 0;
+  }
+
+  /*
+   * Get the maximum of the window. Zero if no sample was added.
+   */
+  auto getMaximum() const -> int16_t {
+    return this->maximumWedge.count > 0 ? this->maximumWedge.candidates[this->maximumWedge.front].value : 0;
+  }
+};
+
+/*
+ * Streaming statistics of a single sensor, updated once per reading.
+ */
+class SensorStatistics {
+
+private:
+  Ewma ewma;
+  RunningVariance runningVariance;
+  MovingExtremes<EXTREMES_WINDOW_LENGTH> extremes;
+
+public:
+  /*
+   * Add a reading to all statistics
+   */
+  void update(int16_t value);
+
+  /*
+   * Get the exponentially weighted moving average
+   */
+  auto getEwma() const -> int16_t;
+
+  /*
+   * Get the mean of all readings
+   */
+  auto getMean() const -> int16_t;
+
+  /*
+   * Get the variance of all readings
+   */
+  auto getVariance() const -> int32_t;
+
+  /*
+   * Get the minimum over the last EXTREMES_WINDOW_LENGTH readings
+   */
+  auto getMinimum() const -> int16_t;
+
+  /*
+   * Get the maximum over the last EXTREMES_WINDOW_LENGTH readings
+   */
+  auto getMaximum() const -> int16_t;
+
+  /*
+   * Get the number of readings
+   */
+  auto getCount() const -> uint32_t;
+};
+
+} // namespace Data
+
+#endif
@@ -44,8 +44,8 @@
  * Constructor
  */
 MainExecutor::Executor::Executor(Sensors::ReadSensors &readSensors, System::Process &systemProcess,
-                                 Data::Process &dataProcess)
-    : readSensors(&readSensors), systemProcess(&systemProcess), dataProcess(&dataProcess) {}
+                                 Data::Process &dataProcess, Timing::Clock &clock)
+    : BasicExecutor(readSensors, systemProcess, dataProcess, clock) {}
 
 /**
  * Runner the setup
@@ -64,24 +64,24 @@ void MainExecutor::Executor::setup() const {
 }
 
 /**
- * Main Loop
+ * Main Loop. Runs every task which is due and returns without waiting when
+ * nothing is due.
  */
 void MainExecutor::Executor::loop() const {
   // TODO(aruncs009@gmail.com): Add logging
   //  Logger::notice("Begin Loop");
-  //  Get duration in millisecond after the system started Runnerning
-  //   TODO(arunc): The value of millis will go back to zero in about 50 days
-  //   time. This needs to be handled.
-  //   TODO(aruncs009@gmail.com): Move this to a function
-  //  unsigned long currentMillis = millis();
-  this->readSensors->readAllSensors();
-
-  this->systemProcess->run();
-
-  this->dataProcess->run();
-
-  // Logger::notice("Delay");
-  delay(DELAY);
+  BasicExecutor::loop();
+}
 
-  // Logger::notice("Repeating Loop");
-}
\ No newline at end of file
+/**
+ * Print one line of the stage timing report over Serial. Lines too long for
+ * the buffer are cut short.
+ */
+void MainExecutor::printStageTimesLine(const uint8_t taskId, const Timing::Histogram &stageTimes) {
+  std::array<char, STAGE_TIMES_LINE_LENGTH> line = {};
+  const int prefixLength =
+      std::snprintf(line.data(), line.size(), "%s [%s] ", TASK_NAMES[taskId], Timing::CYCLE_COUNTER_UNIT);
+  const auto offset = static_cast<size_t>(prefixLength);
+  stageTimes.format(line.data() + offset, line.size() - offset);
+  Serial.println(line.data());
+}
@@ -31,17 +31,39 @@
 #ifndef EXECUTOR_EXECUTOR_HPP
 #define EXECUTOR_EXECUTOR_HPP
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <data/process/process.hpp>
+#include <executor/scheduler/scheduler.hpp>
 #include <sensors/read-sensors/read-sensors.hpp>
 #include <system/process/process.hpp>
+#include <timing/clock/clock.hpp>
+#include <timing/cycle-counter/cycle-counter.hpp>
+#include <timing/hardware-clock/hardware-clock.hpp>
+#include <timing/histogram/histogram.hpp>
 
 namespace MainExecutor {
 
 const uint32_t BAUD_RATE = 115200;
 
-// Delay in executing system loop
-const uint32_t DELAY = 1000; // In milliseconds
+// Identifiers of the scheduled tasks. Tasks which are due at the same time run
+// in this order.
+const uint8_t READ_SENSORS_TASK = 0;
+const uint8_t SYSTEM_PROCESS_TASK = 1;
+const uint8_t DATA_PROCESS_TASK = 2;
+const uint8_t TASK_COUNT = 3;
+
+// Length of a line of the stage timing report, including the terminator
+const size_t STAGE_TIMES_LINE_LENGTH = 256;
+
+// Names of the tasks in the stage timing report
+const std::array<const char *, TASK_COUNT> TASK_NAMES = {{"read-sensors", "system-process", "data-process"}};
+
+// Interval between two runs of each task
+const uint32_t READ_SENSORS_PERIOD = 250;   // In milliseconds
+const uint32_t SYSTEM_PROCESS_PERIOD = 250; // In milliseconds
+const uint32_t DATA_PROCESS_PERIOD = 1000;  // In milliseconds
 
 // const uint8_t ARDUINO_UNO = 0;
 const uint8_t NODE_MCU = 1;
@@ -52,15 +74,136 @@ const uint8_t DEVICE_TYPE = NODE_MCU;
 // Logging enabled
 const bool LOGGING_ENABLED = true;
 
-class Executor {
+/*
+ * Print one line of the stage timing report over Serial
+ */
+void printStageTimesLine(uint8_t taskId, const Timing::Histogram &stageTimes);
+
+/*
+ * Scheduling of the read, system process and data process stages. The stages
+ * and the clock are template parameters and are called by their static type,
+ * so an instantiation with final classes has no virtual calls in the loop and
+ * an instantiation with mocks keeps the test seams. Executor instantiates it
+ * with the base classes of the stages.
+ */
+template <typename ReadStage, typename SystemStage, typename DataStage, typename ClockType = Timing::Clock>
+class BasicExecutor {
 
 private:
-  Sensors::ReadSensors *readSensors;
-  System::Process *systemProcess;
-  Data::Process *dataProcess;
+  ReadStage *readSensors;
+  SystemStage *systemProcess;
+  DataStage *dataProcess;
+  ClockType *clock;
+  // The loop only advances the deadlines, which is not part of the observable
+  // state of the executor
+  mutable Scheduler scheduler;
+  // Run time of every task in cycle counter units. Timing is not part of the
+  // observable state either.
+  mutable std::array<Timing::Histogram, TASK_COUNT> stageTimes;
+
+  /*
+   * Run the task with the given identifier
+   */
+  void runTask(const uint8_t taskId) const {
+    switch (taskId) { // LCOV_EXCL_BR_LINE
+    case READ_SENSORS_TASK:
+      this->readSensors->readAllSensors();
+      break;
+    case SYSTEM_PROCESS_TASK:
+      this->systemProcess->run();
+      break;
+    case DATA_PROCESS_TASK:
+      this->dataProcess->run();
+      break;
+    default:  // LCOV_EXCL_LINE
+      break; // LCOV_EXCL_LINE
+    }
+  }
+
+  /*
+   * Run the task with the given identifier and record its run time
+   */
+  void runTimedTask(const uint8_t taskId) const {
+    const uint32_t start = Timing::readCycleCounter();
+    this->runTask(taskId);
+    this->stageTimes[taskId].record(Timing::readCycleCounter() - start);
+  }
+
+public:
+  explicit BasicExecutor(ReadStage &readSensors, SystemStage &systemProcess, DataStage &dataProcess,
+                         ClockType &clock)
+      : readSensors(&readSensors), systemProcess(&systemProcess), dataProcess(&dataProcess), clock(&clock) {
+    this->scheduler.addTask(READ_SENSORS_TASK, READ_SENSORS_PERIOD, 0);
+    this->scheduler.addTask(SYSTEM_PROCESS_TASK, SYSTEM_PROCESS_PERIOD, 0);
+    this->scheduler.addTask(DATA_PROCESS_TASK, DATA_PROCESS_PERIOD, 0);
+  }
+
+  /*
+   * Run every task which is due now and return without waiting when nothing
+   * is due
+   */
+  void loop() const { this->runDueTasks(this->clock->millis()); }
+
+  /*
+   * Run every task which is due at the given time. Pending edges of edge
+   * sensors run the read and system process tasks right away, outside of the
+   * schedule.
+   */
+  void runDueTasks(const uint32_t now) const {
+    if (this->readSensors->hasPendingEdges()) {
+      this->runTimedTask(READ_SENSORS_TASK);
+      this->runTimedTask(SYSTEM_PROCESS_TASK);
+    }
+    uint8_t taskId = 0;
+    while (this->scheduler.nextDueTask(now, taskId)) {
+      this->runTimedTask(taskId);
+    }
+  }
+
+  /*
+   * Get the time in milliseconds from the given time until the next task is
+   * due
+   */
+  auto timeUntilNextTask(const uint32_t now) const -> uint32_t { return this->scheduler.timeUntilNextTask(now); }
+
+  /*
+   * Wait on the clock until the next task is due. A virtual clock jumps
+   * straight to the deadline.
+   */
+  void waitForNextTask() const { this->clock->delay(this->timeUntilNextTask(this->clock->millis())); }
+
+  /*
+   * Get the run times of the task with the given identifier, in units of
+   * Timing::CYCLE_COUNTER_UNIT
+   */
+  auto getStageTimes(const uint8_t taskId) const -> const Timing::Histogram & { return this->stageTimes.at(taskId); }
+
+  /*
+   * Start collecting the run times of every task anew
+   */
+  void resetStageTimes() const {
+    for (auto &histogram : this->stageTimes) {
+      histogram.reset();
+    }
+  }
+
+  /*
+   * Print a summary of the run times of every task over Serial and start
+   * collecting them anew
+   */
+  void printStageTimes() const {
+    for (uint8_t taskId = 0; taskId < TASK_COUNT; ++taskId) {
+      printStageTimesLine(taskId, this->stageTimes[taskId]);
+    }
+    this->resetStageTimes();
+  }
+};
+
+class Executor : public BasicExecutor<Sensors::ReadSensors, System::Process, Data::Process> {
 
 public:
-  explicit Executor(Sensors::ReadSensors &readSensors, System::Process &systemProcess, Data::Process &dataProcess);
+  explicit Executor(Sensors::ReadSensors &readSensors, System::Process &systemProcess, Data::Process &dataProcess,
+                    Timing::Clock &clock = Timing::getHardwareClock());
 
   /*
    * Runner the Setup
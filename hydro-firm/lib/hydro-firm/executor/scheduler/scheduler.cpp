@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "executor/scheduler/scheduler.hpp"
+
+#include <utility>
+
+/*
+ * Constructor
+ */
+MainExecutor::Scheduler::Scheduler() = default;
+
+/*
+ * Checks if the first task should run before the second one. Tasks with the
+ * same deadline run in the order of their identifiers.
+ */
+auto MainExecutor::Scheduler::isBefore(const Task &first, const Task &second) -> bool {
+  const auto difference = static_cast<int32_t>(first.deadline - second.deadline);
+  return difference < 0 || (difference == 0 && first.id < second.id);
+}
+
+/*
+ * Move the task at the given index up until the heap order is restored.
+ */
+void MainExecutor::Scheduler::siftUp(uint8_t index) {
+  while (index > 0) {
+    const uint8_t parent = (index - 1) / 2;
+    if (!isBefore(this->tasks[index], this->tasks[parent])) {
+      break;
+    }
+    std::swap(this->tasks[index], this->tasks[parent]);
+    index = parent;
+  }
+}
+
+/*
+ * Move the task at the given index down until the heap order is restored.
+ */
+void MainExecutor::Scheduler::siftDown(uint8_t index) {
+  while (true) {
+    const uint8_t left = 2 * index + 1;
+    const uint8_t right = left + 1;
+    uint8_t earliest = index;
+    if (left < this->taskCount && isBefore(this->tasks[left], this->tasks[earliest])) {
+      earliest = left;
+    }
+    if (right < this->taskCount && isBefore(this->tasks[right], this->tasks[earliest])) {
+      earliest = right;
+    }
+    if (earliest == index) {
+      break;
+    }
+    std::swap(this->tasks[index], this->tasks[earliest]);
+    index = earliest;
+  }
+}
+
+/*
+ * Add a periodic task which is first due at the given deadline.
+ */
+auto MainExecutor::Scheduler::addTask(const uint8_t id, const uint32_t period, const uint32_t deadline) -> bool {
+  if (this->taskCount >= MAX_TASKS || period == 0) {
+    return false;
+  }
+  this->tasks[this->taskCount] = Task{id, period, deadline};
+  this->siftUp(this->taskCount);
+  ++this->taskCount;
+  return true;
+}
+
+/*
+ * Take the earliest task which is due at the given time and schedule its next
+ * run. If the task has fallen behind by more than a period, the missed runs are
+ * skipped instead of being executed back to back.
+ */
+auto MainExecutor::Scheduler::nextDueTask(const uint32_t now, uint8_t &id) -> bool {
+  if (this->taskCount == 0 || static_cast<int32_t>(this->tasks[0].deadline - now) > 0) {
+    return false;
+  }
+  Task &task = this->tasks[0];
+  id = task.id;
+  task.deadline += task.period;
+  if (static_cast<int32_t>(task.deadline - now) <= 0) {
+    task.deadline = now + task.period;
+  }
+  this->siftDown(0);
+  return true;
+}
+
+/*
+ * Get the time in milliseconds until the earliest task is due.
+ */
+auto MainExecutor::Scheduler::timeUntilNextTask(const uint32_t now) const -> uint32_t {
+  if (this->taskCount == 0) {
+    return 0;
+  }
+  const auto remaining = static_cast<int32_t>(this->tasks[0].deadline - now);
+  return remaining > 0 ? static_cast<uint32_t>(remaining) : 0;
+}
+
+/*
+ * Get the number of registered tasks
+ */
+auto MainExecutor::Scheduler::getTaskCount() const -> uint8_t { return this->taskCount; }
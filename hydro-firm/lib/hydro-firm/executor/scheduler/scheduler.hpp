@@ -0,0 +1,107 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef EXECUTOR_SCHEDULER_SCHEDULER_HPP
+#define EXECUTOR_SCHEDULER_SCHEDULER_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace MainExecutor {
+
+// Maximum number of tasks that can be registered with the scheduler
+const uint8_t MAX_TASKS = 8;
+
+class Scheduler {
+
+private:
+  struct Task {
+    // Identifier returned to the caller when the task is due
+    uint8_t id;
+    // Interval between two runs of the task, in milliseconds
+    uint32_t period;
+    // Time at which the task is due next, in milliseconds
+    uint32_t deadline;
+  };
+
+  // Tasks kept as a binary min-heap ordered by deadline
+  std::array<Task, MAX_TASKS> tasks = {};
+  uint8_t taskCount = 0;
+
+  /*
+   * Checks if the first task should run before the second one. Deadlines are
+   * compared using the signed difference, so ordering survives the millis()
+   * rollover.
+   */
+  static auto isBefore(const Task &first, const Task &second) -> bool;
+
+  /*
+   * Move the task at the given index up until the heap order is restored.
+   */
+  void siftUp(uint8_t index);
+
+  /*
+   * Move the task at the given index down until the heap order is restored.
+   */
+  void siftDown(uint8_t index);
+
+public:
+  /*
+   * Constructor
+   */
+  explicit Scheduler();
+
+  /*
+   * Add a periodic task which is first due at the given deadline. Returns
+   * false if the scheduler is full or the period is zero.
+   */
+  auto addTask(uint8_t id, uint32_t period, uint32_t deadline) -> bool;
+
+  /*
+   * Take the earliest task which is due at the given time and schedule its
+   * next run. Returns false, without waiting, when no task is due.
+   */
+  auto nextDueTask(uint32_t now, uint8_t &id) -> bool;
+
+  /*
+   * Get the time in milliseconds until the earliest task is due. Returns zero
+   * if a task is already due or no task is registered.
+   */
+  auto timeUntilNextTask(uint32_t now) const -> uint32_t;
+
+  /*
+   * Get the number of registered tasks
+   */
+  auto getTaskCount() const -> uint8_t;
+};
+
+} // namespace MainExecutor
+
+#endif
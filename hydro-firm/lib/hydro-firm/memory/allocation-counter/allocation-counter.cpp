@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <memory/allocation-counter/allocation-counter.hpp>
+
+#ifdef NATIVE
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined __GLIBC__ || defined __APPLE__
+#include <execinfo.h>
+#include <unistd.h>
+#define ALLOCATION_COUNTER_BACKTRACE
+#endif
+
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<uint64_t> allocations(0);
+std::atomic<uint64_t> allocatedBytes(0);
+std::atomic<int> stackCaptures(0);
+// Set while an allocation is being captured, so that the allocations of the
+// capture itself are neither captured nor counted
+thread_local bool capturing = false;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+/*
+ * Print the call stack of an allocation of the given size
+ */
+void captureStack(const std::size_t size) {
+#ifdef ALLOCATION_COUNTER_BACKTRACE
+  capturing = true;
+  std::fprintf(stderr, "Allocation of %zu bytes at:\n", size); // NOLINT(cppcoreguidelines-pro-type-vararg)
+  void *stack[Memory::MAX_STACK_DEPTH];                        // NOLINT(cppcoreguidelines-avoid-c-arrays)
+  const int depth = backtrace(stack, Memory::MAX_STACK_DEPTH);
+  backtrace_symbols_fd(stack, depth, STDERR_FILENO);
+  capturing = false;
+#else
+  (void)size;
+#endif
+}
+
+auto allocate(const std::size_t size) -> void * {
+  if (!capturing) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (stackCaptures.load(std::memory_order_relaxed) > 0) {
+      captureStack(size);
+    }
+  }
+  void *memory = std::malloc(size == 0 ? 1 : size); // NOLINT(cppcoreguidelines-no-malloc) LCOV_EXCL_BR_LINE
+  if (memory == nullptr) {                          // LCOV_EXCL_BR_LINE
+    throw std::bad_alloc();                         // LCOV_EXCL_LINE
+  }
+  return memory;
+}
+
+} // namespace
+
+// The global allocation functions of the native programs are replaced to
+// count every heap allocation
+// NOLINTBEGIN(cppcoreguidelines-no-malloc)
+auto operator new(std::size_t size) -> void * { return allocate(size); }
+auto operator new[](std::size_t size) -> void * { return allocate(size); }
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t /*size*/) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t /*size*/) noexcept { std::free(memory); }
+// NOLINTEND(cppcoreguidelines-no-malloc)
+
+/*
+ * Get the allocations made by the program so far
+ */
+auto Memory::getAllocationTotal() -> AllocationCount {
+  return {allocations.load(std::memory_order_relaxed), allocatedBytes.load(std::memory_order_relaxed)};
+}
+
+Memory::AllocationScope::AllocationScope() : start(getAllocationTotal()) {}
+
+/*
+ * Get the number of allocations made since the scope was entered
+ */
+auto Memory::AllocationScope::getAllocations() const -> uint64_t {
+  return getAllocationTotal().allocations - this->start.allocations;
+}
+
+/*
+ * Get the number of bytes requested since the scope was entered
+ */
+auto Memory::AllocationScope::getBytes() const -> uint64_t { return getAllocationTotal().bytes - this->start.bytes; }
+
+/*
+ * Count from now on
+ */
+void Memory::AllocationScope::restart() { this->start = getAllocationTotal(); }
+
+Memory::AllocationStackCapture::AllocationStackCapture() {
+#ifdef ALLOCATION_COUNTER_BACKTRACE
+  // The first backtrace loads the unwinder, which allocates
+  capturing = true;
+  void *stack[1]; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+  backtrace(stack, 1);
+  capturing = false;
+#endif
+  stackCaptures.fetch_add(1, std::memory_order_relaxed);
+}
+
+Memory::AllocationStackCapture::~AllocationStackCapture() { stackCaptures.fetch_sub(1, std::memory_order_relaxed); }
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef MEMORY_ALLOCATION_COUNTER_ALLOCATION_COUNTER_HPP
+#define MEMORY_ALLOCATION_COUNTER_ALLOCATION_COUNTER_HPP
+
+#include <cstdint>
+
+/*
+ * Heap allocation counting for the native builds. Linking it replaces the
+ * global allocation functions of the program to count the allocations and
+ * the bytes requested; the tests and the benchmarks read them through a
+ * scope. On the target nothing is replaced.
+ */
+namespace Memory {
+
+// Deepest call stack printed for a captured allocation
+const int MAX_STACK_DEPTH = 24;
+
+struct AllocationCount {
+  uint64_t allocations;
+  uint64_t bytes;
+};
+
+/*
+ * Get the allocations made by the program so far
+ */
+auto getAllocationTotal() -> AllocationCount;
+
+/*
+ * Counts the allocations made while the scope is alive
+ */
+class AllocationScope {
+
+private:
+  AllocationCount start;
+
+public:
+  AllocationScope();
+
+  /*
+   * Get the number of allocations made since the scope was entered
+   */
+  auto getAllocations() const -> uint64_t;
+
+  /*
+   * Get the number of bytes requested since the scope was entered
+   */
+  auto getBytes() const -> uint64_t;
+
+  /*
+   * Count from now on
+   */
+  void restart();
+};
+
+/*
+ * Prints the call stack of every allocation made while the capture is alive
+ * to stderr, to find the call site of an unexpected allocation
+ */
+class AllocationStackCapture {
+
+public:
+  AllocationStackCapture();
+  ~AllocationStackCapture();
+  AllocationStackCapture(const AllocationStackCapture &) = delete;
+  auto operator=(const AllocationStackCapture &) -> AllocationStackCapture & = delete;
+};
+
+} // namespace Memory
+
+#endif
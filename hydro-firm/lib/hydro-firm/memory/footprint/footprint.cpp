@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "footprint.hpp"
+
+#include <cstdio>
+
+#ifdef NATIVE
+#include <ArduinoFake.h>
+#else
+#include <Arduino.h>
+#endif
+
+/**
+ * List an object of the given size under the given name
+ */
+auto Memory::FootprintReport::add(const char *name, const size_t size) -> bool {
+  if (this->entryCount >= MAX_FOOTPRINT_ENTRIES) {
+    return false;
+  }
+  this->names.at(this->entryCount) = name;
+  this->sizes.at(this->entryCount) = static_cast<uint32_t>(size);
+  ++this->entryCount;
+  return true;
+}
+
+/**
+ * Get the number of listed objects
+ */
+auto Memory::FootprintReport::getEntryCount() const -> uint8_t { return this->entryCount; }
+
+/**
+ * Get the total size in bytes of the listed objects
+ */
+auto Memory::FootprintReport::getTotal() const -> uint32_t {
+  uint32_t total = 0;
+  for (uint8_t index = 0; index < this->entryCount; ++index) {
+    total += this->sizes.at(index);
+  }
+  return total;
+}
+
+/**
+ * Print one line per listed object and the total over Serial. Names too long
+ * for the line are cut short.
+ */
+void Memory::FootprintReport::print() const {
+  std::array<char, FOOTPRINT_LINE_LENGTH> line = {};
+  for (uint8_t index = 0; index < this->entryCount; ++index) {
+    std::snprintf(line.data(), line.size(), "static %-24s %6u B", this->names.at(index),
+                  static_cast<unsigned>(this->sizes.at(index)));
+    Serial.println(line.data());
+  }
+  std::snprintf(line.data(), line.size(), "static %-24s %6u B", "total", static_cast<unsigned>(this->getTotal()));
+  Serial.println(line.data());
+}
@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef MEMORY_FOOTPRINT_FOOTPRINT_HPP
+#define MEMORY_FOOTPRINT_FOOTPRINT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Memory {
+
+// Maximum number of objects listed in a footprint report
+const uint8_t MAX_FOOTPRINT_ENTRIES = 24;
+// Length of a footprint report line including the terminating null
+const size_t FOOTPRINT_LINE_LENGTH = 48;
+
+/*
+ * Sizes of the objects the firmware keeps in static storage, printed at boot
+ * so that the memory taken before the loop starts is known up front.
+ */
+class FootprintReport {
+
+private:
+  std::array<const char *, MAX_FOOTPRINT_ENTRIES> names = {};
+  std::array<uint32_t, MAX_FOOTPRINT_ENTRIES> sizes = {};
+  uint8_t entryCount = 0;
+
+public:
+  /*
+   * List an object of the given size under the given name. The name is not
+   * copied and must outlive the report. Returns false if
+   * MAX_FOOTPRINT_ENTRIES objects were listed already.
+   */
+  auto add(const char *name, size_t size) -> bool;
+
+  /*
+   * List the given object under the given name
+   */
+  template <typename Type> auto addObject(const char *name, const Type &object) -> bool {
+    return this->add(name, sizeof(object));
+  }
+
+  /*
+   * Get the number of listed objects
+   */
+  auto getEntryCount() const -> uint8_t;
+
+  /*
+   * Get the total size in bytes of the listed objects
+   */
+  auto getTotal() const -> uint32_t;
+
+  /*
+   * Print the size of every listed object over Serial, one line per object,
+   * followed by the total
+   */
+  void print() const;
+};
+
+} // namespace Memory
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <algorithm>
+#include <sensors/analog-mux/analog-mux.hpp>
+#include <timing/hardware-clock/hardware-clock.hpp>
+
+#ifdef NATIVE
+#include <ArduinoFake.h>
+#else
+#include <Arduino.h>
+#endif
+
+namespace Sensors {
+
+/*
+ * Constructor for a multiplexer with the given select pins and settle time
+ */
+AnalogMux::AnalogMux(const std::array<uint8_t, MUX_SELECT_LINES> &selectPins, const uint16_t settleMicros)
+    : selectPins(selectPins), settleMicros(settleMicros), clock(&Timing::getHardwareClock()) {}
+
+/*
+ * Configure the select pins as outputs and select the first channel
+ */
+void AnalogMux::begin() {
+  for (auto selectPin : this->selectPins) {
+    pinMode(selectPin, OUTPUT);
+    digitalWrite(selectPin, LOW);
+  }
+  this->selectedChannel = 0;
+}
+
+/*
+ * Bind the sensor to the given channel
+ */
+auto AnalogMux::addSensor(Sensor &sensor, const uint8_t channel) -> bool {
+  if (channel >= MUX_CHANNELS || this->channels[channel] != nullptr) {
+    return false;
+  }
+  this->channels[channel] = &sensor;
+  sensor.setMuxChannel(channel);
+  return true;
+}
+
+/*
+ * Switch to the given channel. Only the select lines differing from the
+ * current channel are written.
+ */
+void AnalogMux::selectChannel(const uint8_t channel) {
+  const uint8_t changedLines = this->selectedChannel ^ channel;
+  for (uint8_t line = 0; line < MUX_SELECT_LINES; ++line) {
+    if ((changedLines >> line) & 1U) {
+      digitalWrite(this->selectPins[line], ((channel >> line) & 1U) ? HIGH : LOW);
+    }
+  }
+  this->selectedChannel = channel;
+}
+
+/*
+ * Select, settle and sample the sensor bound to the given channel
+ */
+void AnalogMux::sampleChannel(const uint8_t channel) {
+  Sensor *const sensor = this->channels[channel];
+  if (sensor == nullptr) {
+    return;
+  }
+  this->selectChannel(channel);
+  this->clock->delayMicroseconds(this->settleMicros);
+  sensor->sampleSensor(); // LCOV_EXCL_BR_LINE
+}
+
+/*
+ * Power on the bound sensors, wait once for the longest read delay, sample
+ * every bound channel and power the sensors off. A forward scan ends on the
+ * last Gray code channel, where the following backward scan starts.
+ */
+void AnalogMux::scan() {
+  bool isPoweredOn = false;
+  int16_t readDelay = 0;
+  for (auto sensor : this->channels) {
+    if (sensor != nullptr && sensor->isPowerOnRequired()) {
+      sensor->powerOnSensor();
+      isPoweredOn = true;
+      readDelay = std::max(readDelay, sensor->getReadDelay());
+    }
+  }
+
+  if (isPoweredOn) {
+    this->clock->delay(static_cast<uint32_t>(readDelay));
+  }
+
+  for (uint8_t step = 0; step < MUX_CHANNELS; ++step) {
+    const uint8_t position = this->isScanningForward ? step : static_cast<uint8_t>(MUX_CHANNELS - 1 - step);
+    this->sampleChannel(grayCode(position));
+  }
+  this->isScanningForward = !this->isScanningForward;
+
+  for (auto sensor : this->channels) {
+    if (sensor != nullptr && sensor->isPowerOnRequired()) {
+      sensor->powerOffSensor();
+    }
+  }
+}
+
+/*
+ * Wait on the given clock after powering on the sensors
+ */
+void AnalogMux::setClock(Timing::Clock &clock) { this->clock = &clock; }
+
+/*
+ * Get the currently selected channel
+ */
+auto AnalogMux::getSelectedChannel() const -> uint8_t { return this->selectedChannel; }
+
+} // namespace Sensors
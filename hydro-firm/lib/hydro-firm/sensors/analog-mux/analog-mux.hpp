@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SENSORS_ANALOG_MUX_ANALOG_MUX_HPP
+#define SENSORS_ANALOG_MUX_ANALOG_MUX_HPP
+
+#include <array>
+#include <cstdint>
+#include <sensors/sensor.hpp>
+#include <timing/clock/clock.hpp>
+
+namespace Sensors {
+
+// Select lines of a 16 channel analog multiplexer like the CD74HC4067
+const uint8_t MUX_SELECT_LINES = 4;
+const uint8_t MUX_CHANNELS = 1U << MUX_SELECT_LINES;
+
+// Microseconds for the multiplexer output to settle after switching channels
+const uint16_t DEFAULT_MUX_SETTLE_MICROS = 10;
+
+/*
+ * Analog multiplexer in front of the single ADC pin. Sensors bound to its
+ * channels are read with the ADC pin as read pin. A scan powers all bound
+ * sensors together, waits once for the slowest one and then samples the
+ * channels in Gray code order, so consecutive channels differ in one select
+ * line. Every scan runs in the opposite direction of the previous one and
+ * starts on the channel the previous scan ended on.
+ */
+class AnalogMux {
+
+private:
+  const std::array<uint8_t, MUX_SELECT_LINES> selectPins;
+  const uint16_t settleMicros;
+  std::array<Sensor *, MUX_CHANNELS> channels = {};
+  uint8_t selectedChannel = 0;
+  bool isScanningForward = true;
+  Timing::Clock *clock;
+
+  /*
+   * Switch to the given channel, writing only the select lines which change
+   */
+  void selectChannel(uint8_t channel);
+
+  /*
+   * Select, settle and sample the sensor bound to the given channel, if any
+   */
+  void sampleChannel(uint8_t channel);
+
+public:
+  /*
+   * Constructor for a multiplexer with the given select pins, least
+   * significant first, and settle time after switching channels
+   */
+  explicit AnalogMux(const std::array<uint8_t, MUX_SELECT_LINES> &selectPins,
+                     uint16_t settleMicros = DEFAULT_MUX_SETTLE_MICROS);
+
+  /*
+   * Configure the select pins as outputs and select the first channel
+   */
+  void begin();
+
+  /*
+   * Bind the sensor to the given channel. Returns false if the channel is out
+   * of range or already bound.
+   */
+  auto addSensor(Sensor &sensor, uint8_t channel) -> bool;
+
+  /*
+   * Power on the bound sensors, wait once for the longest read delay, sample
+   * every bound channel and power the sensors off
+   */
+  void scan();
+
+  /*
+   * Wait on the given clock after powering on the sensors instead of the
+   * hardware clock
+   */
+  void setClock(Timing::Clock &clock);
+
+  /*
+   * Get the currently selected channel
+   */
+  auto getSelectedChannel() const -> uint8_t;
+};
+
+/*
+ * Get the channel visited at the given step of a Gray code scan
+ */
+constexpr auto grayCode(const uint8_t step) -> uint8_t { return static_cast<uint8_t>(step ^ (step >> 1U)); }
+
+} // namespace Sensors
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <sensors/edge-sensor/edge-sensor.hpp>
+
+#ifdef NATIVE
+#include <ArduinoFake.h>
+#define EDGE_ISR_ATTR
+#else
+#include <Arduino.h>
+#define EDGE_ISR_ATTR IRAM_ATTR
+#endif
+
+namespace Sensors {
+
+namespace {
+
+// Latches written by the interrupt handlers and the pins they read, one per
+// attached edge sensor. Plain arrays, so indexing them calls no flash code.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-c-arrays)
+EdgeLatch edgeLatches[MAX_EDGE_SENSORS];
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-c-arrays)
+uint8_t edgePins[MAX_EDGE_SENSORS] = {};
+std::array<bool, MAX_EDGE_SENSORS> isEdgeSlotUsed = {}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/*
+ * Interrupt handler latching the level of the pin of the given slot. Besides
+ * the arrays above it only calls EdgeLatch::latch(), digitalRead() and
+ * millis(), which all live in IRAM.
+ */
+template <uint8_t SLOT> EDGE_ISR_ATTR void onPinChange() {
+  edgeLatches[SLOT].latch(static_cast<uint8_t>(digitalRead(edgePins[SLOT])), static_cast<uint32_t>(millis()));
+}
+
+// attachInterrupt() takes a plain function, so every slot has its own handler
+const std::array<void (*)(), MAX_EDGE_SENSORS> EDGE_HANDLERS = {
+    {&onPinChange<0>, &onPinChange<1>, &onPinChange<2>, &onPinChange<3>}};
+
+} // namespace
+
+/*
+ * Reset the latch to the given level without edges
+ */
+void EdgeLatch::reset(const uint8_t activeLevel, const uint8_t level) {
+  this->activeLevel = activeLevel;
+  this->level = level;
+  this->drainedEdgeCount = this->edgeCount;
+  this->drainedActiveEdgeCount = this->activeEdgeCount;
+}
+
+/*
+ * Latch an edge to the given level at the given time. The odd sequence number
+ * marks the fields as being written.
+ */
+EDGE_ISR_ATTR void EdgeLatch::latch(const uint8_t level, const uint32_t now) {
+  this->sequence = this->sequence + 1;
+  this->edgeCount = this->edgeCount + 1;
+  if (level == this->activeLevel) {
+    this->activeEdgeCount = this->activeEdgeCount + 1;
+  }
+  this->lastEdgeMillis = now;
+  this->level = level;
+  this->sequence = this->sequence + 1;
+}
+
+/*
+ * Take the edges latched since the previous drain. The fields are copied again
+ * if the interrupt handler latched an edge while they were being copied.
+ */
+auto EdgeLatch::drain() -> EdgeDrain {
+  EdgeDrain latched;
+  uint32_t startSequence = 0;
+  do {
+    startSequence = this->sequence;
+    latched.edgeCount = this->edgeCount;
+    latched.activeEdgeCount = this->activeEdgeCount;
+    latched.lastEdgeMillis = this->lastEdgeMillis;
+    latched.level = this->level;
+  } while ((startSequence & 1U) != 0 || startSequence != this->sequence); // LCOV_EXCL_BR_LINE
+
+  EdgeDrain drained = latched;
+  drained.edgeCount = latched.edgeCount - this->drainedEdgeCount;
+  drained.activeEdgeCount = latched.activeEdgeCount - this->drainedActiveEdgeCount;
+  this->drainedEdgeCount = latched.edgeCount;
+  this->drainedActiveEdgeCount = latched.activeEdgeCount;
+  return drained;
+}
+
+/*
+ * Checks if edges were latched since the previous drain
+ */
+auto EdgeLatch::hasPendingEdges() const -> bool { return this->edgeCount != this->drainedEdgeCount; }
+
+/*
+ * Constructor for an edge sensor on the given pin
+ */
+EdgeSensor::EdgeSensor(const char *type, const uint8_t readPin, const uint8_t activeLevel)
+    : Sensor(type, DIGITAL, readPin), activeLevel(activeLevel) {}
+
+/*
+ * Destructor detaching the interrupt
+ */
+EdgeSensor::~EdgeSensor() { this->end(); }
+
+/*
+ * Attach the pin change interrupt to a free latch. The latch starts at the
+ * current level of the pin.
+ */
+auto EdgeSensor::begin() -> bool {
+  if (this->slot != NO_EDGE_SLOT) {
+    return true;
+  }
+  const int interrupt = digitalPinToInterrupt(this->getReadPin());
+  if (interrupt == NOT_AN_INTERRUPT) {
+    return false;
+  }
+  for (uint8_t slot = 0; slot < MAX_EDGE_SENSORS; ++slot) {
+    if (!isEdgeSlotUsed[slot]) {
+      isEdgeSlotUsed[slot] = true;
+      this->slot = slot;
+      edgePins[slot] = this->getReadPin();
+      edgeLatches[slot].reset(this->activeLevel, static_cast<uint8_t>(digitalRead(this->getReadPin())));
+      attachInterrupt(static_cast<uint8_t>(interrupt), EDGE_HANDLERS[slot], CHANGE);
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * Detach the pin change interrupt and release its latch
+ */
+void EdgeSensor::end() {
+  if (this->slot == NO_EDGE_SLOT) {
+    return;
+  }
+  detachInterrupt(static_cast<uint8_t>(digitalPinToInterrupt(this->getReadPin())));
+  isEdgeSlotUsed[this->slot] = false;
+  this->slot = NO_EDGE_SLOT;
+}
+
+/*
+ * Drain the latched edges into the reading. A polled sensor reads the pin.
+ */
+void EdgeSensor::sampleSensor() {
+  if (this->slot == NO_EDGE_SLOT) {
+    Sensor::sampleSensor();
+    this->reading = Sensor::getReading();
+    return;
+  }
+  this->initSensor();
+  this->lastDrain = edgeLatches[this->slot].drain();
+  this->reading = this->lastDrain.activeEdgeCount > 0 ? this->activeLevel : this->lastDrain.level;
+}
+
+/*
+ * Get the reading of the last read cycle
+ */
+auto EdgeSensor::getReading() const -> int { return this->reading; }
+
+/*
+ * Get the edges drained by the last read cycle
+ */
+auto EdgeSensor::getLastDrain() const -> const EdgeDrain & { return this->lastDrain; }
+
+/*
+ * Checks if the sensor is read through a pin change interrupt
+ */
+auto EdgeSensor::isInterruptDriven() const -> bool { return this->slot != NO_EDGE_SLOT; }
+
+/*
+ * Checks if any edge sensor latched edges which no read cycle drained yet
+ */
+auto hasPendingEdges() -> bool {
+  for (uint8_t slot = 0; slot < MAX_EDGE_SENSORS; ++slot) {
+    if (isEdgeSlotUsed[slot] && edgeLatches[slot].hasPendingEdges()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace Sensors
@@ -0,0 +1,167 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SENSORS_EDGE_SENSOR_EDGE_SENSOR_HPP
+#define SENSORS_EDGE_SENSOR_EDGE_SENSOR_HPP
+
+#include <cstdint>
+#include <sensors/sensor.hpp>
+
+namespace Sensors {
+
+// Maximum number of edge sensors with an attached pin change interrupt
+const uint8_t MAX_EDGE_SENSORS = 4;
+
+// Slot of an edge sensor which is polled instead of interrupt driven
+const uint8_t NO_EDGE_SLOT = UINT8_MAX;
+
+/*
+ * Edges latched by the pin change interrupt since the previous drain
+ */
+struct EdgeDrain {
+  uint32_t edgeCount = 0;
+  uint32_t activeEdgeCount = 0;
+  uint32_t lastEdgeMillis = 0;
+  uint8_t level = 0;
+};
+
+/*
+ * Edges of one pin latched by its interrupt handler. The handler is the only
+ * writer of the volatile fields and brackets its writes with an odd sequence
+ * number, so the reader retries instead of disabling interrupts. The reader
+ * only writes the drained counts.
+ */
+class EdgeLatch {
+
+private:
+  volatile uint32_t sequence = 0;
+  volatile uint32_t edgeCount = 0;
+  volatile uint32_t activeEdgeCount = 0;
+  volatile uint32_t lastEdgeMillis = 0;
+  volatile uint8_t level = 0;
+  uint32_t drainedEdgeCount = 0;
+  uint32_t drainedActiveEdgeCount = 0;
+  uint8_t activeLevel = 0;
+
+public:
+
+  /*
+   * Reset the latch to the given level without edges
+   */
+  void reset(uint8_t activeLevel, uint8_t level);
+
+  /*
+   * Latch an edge to the given level at the given time. Called from the
+   * interrupt handler, so it is placed in IRAM on the target.
+   */
+  void latch(uint8_t level, uint32_t now);
+
+  /*
+   * Take the edges latched since the previous drain
+   */
+  auto drain() -> EdgeDrain;
+
+  /*
+   * Checks if edges were latched since the previous drain
+   */
+  auto hasPendingEdges() const -> bool;
+};
+
+/*
+ * Digital sensor read through a pin change interrupt. Edges are latched as
+ * they happen and drained by every read cycle, so a pulse to the active level
+ * between two read cycles is reported as active for one cycle. Without an
+ * attached interrupt the sensor polls the pin like any digital sensor.
+ */
+class EdgeSensor : public Sensor {
+
+private:
+  const uint8_t activeLevel;
+  uint8_t slot = NO_EDGE_SLOT;
+  EdgeDrain lastDrain;
+  int reading = 0;
+
+public:
+  /*
+   * Constructor for an edge sensor on the given pin which counts edges to
+   * the given level as active
+   */
+  explicit EdgeSensor(const char *type, uint8_t readPin, uint8_t activeLevel);
+
+  EdgeSensor(const EdgeSensor &) = delete;
+  auto operator=(const EdgeSensor &) -> EdgeSensor & = delete;
+
+  /*
+   * Destructor detaching the interrupt
+   */
+  ~EdgeSensor();
+
+  /*
+   * Attach the pin change interrupt, if not attached yet. Returns false,
+   * leaving the sensor polled, if the pin has no interrupt or all latches are
+   * in use.
+   */
+  auto begin() -> bool;
+
+  /*
+   * Detach the pin change interrupt and release its latch
+   */
+  void end();
+
+  /*
+   * Drain the latched edges into the reading
+   */
+  void sampleSensor() override;
+
+  /*
+   * Get the active level if an active edge was latched since the previous
+   * read cycle, otherwise the current level
+   */
+  auto getReading() const -> int override;
+
+  /*
+   * Get the edges drained by the last read cycle
+   */
+  auto getLastDrain() const -> const EdgeDrain &;
+
+  /*
+   * Checks if the sensor is read through a pin change interrupt
+   */
+  auto isInterruptDriven() const -> bool;
+};
+
+/*
+ * Checks if any edge sensor latched edges which no read cycle drained yet
+ */
+auto hasPendingEdges() -> bool;
+
+} // namespace Sensors
+
+#endif
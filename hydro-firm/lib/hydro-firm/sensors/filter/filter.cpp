@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <sensors/filter/filter.hpp>
+
+namespace {
+
+/*
+ * Order two samples without branching. The difference of two 16 bit samples
+ * always fits in 32 bits, so its sign bit selects the smaller sample.
+ */
+inline void compareExchange(int16_t &first, int16_t &second) {
+  const int32_t difference = static_cast<int32_t>(first) - static_cast<int32_t>(second);
+  const int32_t isGreater = -static_cast<int32_t>(difference > 0);
+  const int32_t swapBy = difference & isGreater;
+  first = static_cast<int16_t>(first - swapBy);
+  second = static_cast<int16_t>(second + swapBy);
+}
+
+/*
+ * Divide a non negative sum by the count, rounding to the nearest integer
+ */
+inline auto roundedDivide(int32_t sum, uint8_t count) -> int16_t {
+  return static_cast<int16_t>((sum + count / 2) / count);
+}
+
+} // namespace
+
+namespace Sensors {
+
+/*
+ * Sort the samples in ascending order using an odd-even transposition sorting
+ * network.
+ */
+void sortSamples(int16_t *samples, const uint8_t count) {
+  for (uint8_t round = 0; round < count; ++round) {
+    for (uint8_t index = round & 1U; index + 1 < count; index += 2) {
+      compareExchange(samples[index], samples[index + 1]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+}
+
+/*
+ * Get the rounded mean of the samples
+ */
+auto meanOfSamples(const int16_t *samples, const uint8_t count) -> int16_t {
+  int32_t sum = 0;
+  for (uint8_t index = 0; index < count; ++index) {
+    sum += samples[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+  return roundedDivide(sum, count);
+}
+
+/*
+ * Get the median of the samples. For an even number of samples the rounded
+ * mean of the two middle samples is returned.
+ */
+auto medianOfSamples(int16_t *samples, const uint8_t count) -> int16_t {
+  sortSamples(samples, count);
+  const uint8_t upper = count / 2;
+  const uint8_t lower = (count - 1) / 2;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return roundedDivide(static_cast<int32_t>(samples[lower]) + samples[upper], 2);
+}
+
+/*
+ * Get the rounded mean of the samples after dropping the lowest and highest
+ * count / TRIM_DIVISOR samples.
+ */
+auto trimmedMeanOfSamples(int16_t *samples, const uint8_t count) -> int16_t {
+  sortSamples(samples, count);
+  const uint8_t trimmed = count / TRIM_DIVISOR;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return meanOfSamples(samples + trimmed, count - 2 * trimmed);
+}
+
+/*
+ * Combine the samples into a single value using the given filter.
+ */
+auto filterSamples(const FILTER_TYPE filterType, int16_t *samples, const uint8_t count) -> int16_t {
+  switch (filterType) {
+  case MEDIAN:
+    return medianOfSamples(samples, count);
+  case TRIMMED_MEAN:
+    return trimmedMeanOfSamples(samples, count);
+  default:
+    return meanOfSamples(samples, count);
+  }
+}
+
+} // namespace Sensors
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SENSORS_FILTER_FILTER_HPP
+#define SENSORS_FILTER_FILTER_HPP
+
+#include <cstdint>
+
+namespace Sensors {
+
+// Maximum number of samples taken in one oversampling burst
+const uint8_t MAX_SAMPLE_COUNT = 16;
+
+// Share of samples dropped from each end by the trimmed mean (1 / TRIM_DIVISOR)
+const uint8_t TRIM_DIVISOR = 4;
+
+// Filter used for combining the samples of an oversampling burst
+enum FILTER_TYPE { MEAN, MEDIAN, TRIMMED_MEAN };
+
+/*
+ * Sort the samples in ascending order using an odd-even transposition sorting
+ * network. The sequence of compare-exchange steps only depends on the number
+ * of samples and each step is branchless.
+ */
+void sortSamples(int16_t *samples, uint8_t count);
+
+/*
+ * Get the rounded mean of the samples
+ */
+auto meanOfSamples(const int16_t *samples, uint8_t count) -> int16_t;
+
+/*
+ * Get the median of the samples. The samples are sorted in place.
+ */
+auto medianOfSamples(int16_t *samples, uint8_t count) -> int16_t;
+
+/*
+ * Get the rounded mean of the samples after dropping the lowest and highest
+ * count / TRIM_DIVISOR samples. The samples are sorted in place.
+ */
+auto trimmedMeanOfSamples(int16_t *samples, uint8_t count) -> int16_t;
+
+/*
+ * Combine the samples into a single value using the given filter. The samples
+ * may be reordered.
+ */
+auto filterSamples(FILTER_TYPE filterType, int16_t *samples, uint8_t count) -> int16_t;
+
+} // namespace Sensors
+
+#endif
@@ -31,7 +31,14 @@
 
 #include <sensors/moisture-level/moisture-level.hpp>
 
+#ifndef NATIVE
+#include <Arduino.h>
+#endif
+
 namespace Sensors {
+
+const char MOISTURE_LEVEL_SENSOR[] SENSOR_NAME_STORAGE = "Moisture Level Sensor";
+
 /*
  * Constructor for setting Read Pin, Power Pin and Delay
  */
@@ -36,10 +36,11 @@
 
 namespace Sensors {
 
-static const std::string MOISTURE_LEVEL_SENSOR = "Moisture Level Sensor";
+// Name of the moisture level sensor, kept in flash on the target
+extern const char MOISTURE_LEVEL_SENSOR[];
 static const SENSOR_TYPE MOISTURE_LEVEL_TYPE = ANALOG;
 
-class MoistureLevelSensor : public Sensors::Sensor {
+class MoistureLevelSensor final : public Sensors::Sensor {
 
 public:
   /*
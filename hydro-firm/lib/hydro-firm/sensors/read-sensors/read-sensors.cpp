@@ -30,38 +30,214 @@
  */
 
 #include "sensors/read-sensors/read-sensors.hpp"
+#include <algorithm>
 #include <cstdint>
-#include <iostream>
-#include <list>
-#include <map>
+#include <sensors/edge-sensor/edge-sensor.hpp>
+
+#ifdef NATIVE
+#include <cstring>
+#else
+#include <Arduino.h>
+#endif
+
+namespace {
+
+/*
+ * Checks if the name matches the sensor name kept in flash
+ */
+auto isSameName(const char *name, const char *sensorName) -> bool {
+#ifdef NATIVE
+  return std::strcmp(name, sensorName) == 0;
+#else
+  return strcmp_P(name, sensorName) == 0;
+#endif
+}
+
+} // namespace
+
 /*
  * Constructor
  */
 
-Sensors::ReadSensors::ReadSensors(std::list<Sensors::Sensor *> &sensors) : sensors{sensors} {}
+Sensors::ReadSensors::ReadSensors(SensorRegistry &sensors, const READ_MODE readMode, Timing::Clock &clock)
+    : sensors{&sensors}, readMode(readMode), clock(&clock) {
+  sensors.setClock(clock);
+}
+
+/*
+ * Get the reading of the sensor with the given identifier
+ */
+auto Sensors::ReadingSnapshot::getReading(const SENSOR_ID sensorId) const -> int {
+  return sensorId < this->count ? this->readings[sensorId] : 0;
+}
+
+/*
+ * Get the snapshot being filled by the current read cycle
+ */
+auto Sensors::ReadSensors::getBackSnapshot() -> ReadingSnapshot & { return this->snapshots[this->frontSnapshot ^ 1U]; }
+
+/*
+ * Publish the back snapshot as the latest readings
+ */
+void Sensors::ReadSensors::publishSnapshot() {
+  ReadingSnapshot &backSnapshot = this->getBackSnapshot();
+  backSnapshot.count = this->sensors->size();
+  backSnapshot.sequence = this->snapshots[this->frontSnapshot].sequence + 1;
+  this->frontSnapshot ^= 1U;
+}
+
+/*
+ * Get the read mode
+ */
+auto Sensors::ReadSensors::getReadMode() const -> READ_MODE { return this->readMode; }
+
+/*
+ * Get the clock the read delays are waited on
+ */
+auto Sensors::ReadSensors::getClock() const -> Timing::Clock & { return *this->clock; }
 
 /*
  * Read all sensors.
  */
 void Sensors::ReadSensors::readAllSensors() {
   // Logger::notice("Sensors>Read-Sensors", "Start reading sensors");
-  for (auto sensor : this->sensors) {
+  if (this->readMode == BATCHED) {
+    this->readSensorsBatched();
+  } else {
+    this->readSensorsSequentially();
+  }
+  this->readMuxSensors();
+  this->publishSnapshot();
+}
+
+/*
+ * Read the sensors bound to the given analog multiplexer with one scan
+ */
+void Sensors::ReadSensors::setAnalogMux(AnalogMux &analogMux) {
+  this->analogMux = &analogMux;
+  analogMux.setClock(*this->clock);
+}
+
+/*
+ * Scan the analog multiplexer and store the readings of the sensors bound to
+ * it. The scan shares one read delay across all its channels.
+ */
+void Sensors::ReadSensors::readMuxSensors() {
+  if (this->analogMux == nullptr) {
+    return;
+  }
+  this->analogMux->scan();
+  ReadingSnapshot &backSnapshot = this->getBackSnapshot();
+  for (auto sensor : *this->sensors) {
+    if (sensor->getMuxChannel() != NO_MUX_CHANNEL) {
+      backSnapshot.readings[sensor->getId()] = sensor->getReading();
+    }
+  }
+}
+
+/*
+ * Read the sensors one after the other. Every powered sensor adds its own
+ * read delay to the cycle.
+ */
+void Sensors::ReadSensors::readSensorsSequentially() {
+  ReadingSnapshot &backSnapshot = this->getBackSnapshot();
+  for (auto sensor : *this->sensors) {
+    if (sensor->getMuxChannel() != NO_MUX_CHANNEL) {
+      continue;
+    }
     sensor->readSensor();                                           // LCOV_EXCL_BR_LINE
-    this->sensorReadings[sensor->getType()] = sensor->getReading(); // LCOV_EXCL_BR_LINE
+    backSnapshot.readings[sensor->getId()] = sensor->getReading();
+  }
+}
+
+/*
+ * Power on all sensors, wait once for the longest read delay, read all sensors
+ * and power them off. The cycle costs a single read delay irrespective of the
+ * number of sensors.
+ */
+void Sensors::ReadSensors::readSensorsBatched() {
+  bool isPoweredOn = false;
+  int16_t readDelay = 0;
+  for (auto sensor : *this->sensors) {
+    if (sensor->getMuxChannel() == NO_MUX_CHANNEL && sensor->isPowerOnRequired()) {
+      sensor->powerOnSensor();
+      isPoweredOn = true;
+      readDelay = std::max(readDelay, sensor->getReadDelay());
+    }
+  }
+
+  if (isPoweredOn) {
+    this->clock->delay(static_cast<uint32_t>(readDelay));
+  }
+
+  ReadingSnapshot &backSnapshot = this->getBackSnapshot();
+  for (auto sensor : *this->sensors) {
+    if (sensor->getMuxChannel() != NO_MUX_CHANNEL) {
+      continue;
+    }
+    sensor->sampleSensor();                                         // LCOV_EXCL_BR_LINE
+    backSnapshot.readings[sensor->getId()] = sensor->getReading();
+  }
+
+  for (auto sensor : *this->sensors) {
+    if (sensor->getMuxChannel() == NO_MUX_CHANNEL && sensor->isPowerOnRequired()) {
+      sensor->powerOffSensor();
+    }
   }
 }
 
 /*
- * Method for getting the sensor reading
+ * Method for getting the latest published readings of all sensors
  */
-auto Sensors::ReadSensors::getAllSensorReading() const -> std::map<const std::string, int> {
+auto Sensors::ReadSensors::getAllSensorReading() const -> const ReadingSnapshot & {
   // Logger::notice("Sensors>Read-Sensors", "Get sensor reading values");
-  return this->sensorReadings;
+  return this->snapshots[this->frontSnapshot];
 }
 
 /*
  * Method for getting the reading of a specific sensor
  */
-auto Sensors::ReadSensors::getSensorReading(const std::string &sensorName) -> int {
-  return this->sensorReadings[sensorName];
-}
\ No newline at end of file
+auto Sensors::ReadSensors::getSensorReading(const char *const sensorName) -> int {
+  return this->getSensorReadingById(this->getSensorId(sensorName));
+}
+
+/*
+ * Method for getting the reading of the sensor with the given identifier
+ */
+auto Sensors::ReadSensors::getSensorReadingById(const SENSOR_ID sensorId) const -> int {
+  return this->snapshots[this->frontSnapshot].getReading(sensorId);
+}
+
+/*
+ * Get the identifier of the first sensor of the given type. The name
+ * constants are matched by address first, which reads no name from flash.
+ */
+auto Sensors::ReadSensors::getSensorId(const char *const sensorName) const -> SENSOR_ID {
+  for (auto sensor : *this->sensors) {
+    if (sensor->getType() == sensorName) {
+      return sensor->getId();
+    }
+  }
+  // Not a name constant, such as a name received over the network
+  for (auto sensor : *this->sensors) {
+    if (isSameName(sensorName, sensor->getType())) {
+      return sensor->getId();
+    }
+  }
+  return INVALID_SENSOR_ID;
+}
+
+/*
+ * Get the number of registered sensors
+ */
+auto Sensors::ReadSensors::getSensorCount() const -> uint8_t { return this->sensors->size(); }
+
+/*
+ * Get the sequence number of the latest published snapshot
+ */
+auto Sensors::ReadSensors::getSequence() const -> uint32_t { return this->snapshots[this->frontSnapshot].sequence; }
+
+/*
+ * Checks if an edge sensor latched edges which no read cycle drained yet
+ */
+auto Sensors::ReadSensors::hasPendingEdges() const -> bool { return Sensors::hasPendingEdges(); }
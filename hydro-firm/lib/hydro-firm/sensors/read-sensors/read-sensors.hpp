@@ -32,23 +32,95 @@
 #ifndef SENSORS_READ_SENSORS_READ_SENSORS_HPP
 #define SENSORS_READ_SENSORS_READ_SENSORS_HPP
 
-#include <list>
-#include <map>
+#include <array>
+#include <cstdint>
+#include <sensors/analog-mux/analog-mux.hpp>
+#include <sensors/sensor-set/sensor-set.hpp>
 #include <sensors/sensor.hpp>
+#include <timing/clock/clock.hpp>
+#include <timing/hardware-clock/hardware-clock.hpp>
 
 namespace Sensors {
 
+// SEQUENTIAL powers, waits for and reads one sensor at a time. BATCHED powers
+// all sensors together and waits once for the slowest one before reading.
+enum READ_MODE { SEQUENTIAL, BATCHED };
+
+/*
+ * Readings of all sensors from one read cycle, indexed by the sensor
+ * identifier. The sequence number increases with every published snapshot.
+ */
+struct ReadingSnapshot {
+  std::array<int, MAX_SENSORS> readings = {};
+  uint8_t count = 0;
+  uint32_t sequence = 0;
+
+  /*
+   * Get the reading of the sensor with the given identifier. Returns zero for
+   * an identifier which is not in the snapshot.
+   */
+  auto getReading(SENSOR_ID sensorId) const -> int;
+};
+
 class ReadSensors {
 
 private:
-  const std::list<Sensor *> sensors = {};
-  std::map<const std::string, int> sensorReadings = std::map<const std::string, int>();
+  const SensorRegistry *sensors;
+  const READ_MODE readMode;
+  Timing::Clock *clock;
+  AnalogMux *analogMux = nullptr;
+  // Readings are written to the back snapshot and published by flipping the
+  // front index, so the front snapshot is never partially updated
+  std::array<ReadingSnapshot, 2> snapshots = {};
+  uint8_t frontSnapshot = 0;
+
+  /*
+   * Read the sensors one after the other.
+   */
+  void readSensorsSequentially();
+
+  /*
+   * Power on all sensors, wait once for the longest read delay, read all
+   * sensors and power them off.
+   */
+  void readSensorsBatched();
+
+  /*
+   * Scan the analog multiplexer and store the readings of the sensors bound
+   * to it.
+   */
+  void readMuxSensors();
+
+protected:
+  /*
+   * Get the snapshot being filled by the current read cycle
+   */
+  auto getBackSnapshot() -> ReadingSnapshot &;
+
+  /*
+   * Publish the back snapshot as the latest readings
+   */
+  void publishSnapshot();
+
+  /*
+   * Get the read mode
+   */
+  auto getReadMode() const -> READ_MODE;
+
+  /*
+   * Get the clock the read delays are waited on
+   */
+  auto getClock() const -> Timing::Clock &;
 
 public:
   /*
-   * Constructor
+   * Constructor. The identifiers assigned by the sensor registry index the
+   * reading table. The read delays are waited on the given clock, which is
+   * also handed to the sensors of the registry, including those registered
+   * later.
    */
-  explicit ReadSensors(std::list<Sensors::Sensor *> &sensors);
+  explicit ReadSensors(SensorRegistry &sensors, READ_MODE readMode = SEQUENTIAL,
+                       Timing::Clock &clock = Timing::getHardwareClock());
 
   /*
    * Read all sensors.
@@ -56,14 +128,56 @@ public:
   virtual void readAllSensors();
 
   /*
-   * Method for getting the sensor reading
+   * Read the sensors bound to the given analog multiplexer with one scan per
+   * read cycle instead of one by one. The multiplexer waits on the clock of
+   * this instance.
+   */
+  void setAnalogMux(AnalogMux &analogMux);
+
+  /*
+   * Method for getting the latest published readings of all sensors. The
+   * returned snapshot is not copied and stays unchanged until the next read
+   * cycle publishes a new one.
+   */
+  virtual auto getAllSensorReading() const -> const ReadingSnapshot &;
+
+  /*
+   * Method for getting the reading of the sensor with the given name
+   * constant. Looks up the sensor on every call, prefer
+   * getSensorReadingById().
+   */
+  virtual auto getSensorReading(const char *sensorName) -> int;
+
+  /*
+   * Method for getting the reading of the sensor with the given identifier.
+   * Returns zero for an identifier which is not registered.
+   */
+  virtual auto getSensorReadingById(SENSOR_ID sensorId) const -> int;
+
+  /*
+   * Get the identifier of the first sensor with the given name constant, such
+   * as WATER_LEVEL_SENSOR. A name constant is matched by address, so the
+   * lookup neither allocates nor reads the names from flash; any other string
+   * is compared with the names. Returns INVALID_SENSOR_ID if no such sensor
+   * is registered.
+   */
+  auto getSensorId(const char *sensorName) const -> SENSOR_ID;
+
+  /*
+   * Get the number of registered sensors
+   */
+  auto getSensorCount() const -> uint8_t;
+
+  /*
+   * Get the sequence number of the latest published snapshot
    */
-  virtual auto getAllSensorReading() const -> std::map<const std::string, int>;
+  auto getSequence() const -> uint32_t;
 
   /*
-   * Method for getting the reading of a specific sensor
+   * Checks if an edge sensor latched edges which no read cycle drained yet,
+   * so the next read cycle should not wait for its period
    */
-  virtual auto getSensorReading(const std::string &sensorName) -> int;
+  auto hasPendingEdges() const -> bool;
 };
 
 } // namespace Sensors
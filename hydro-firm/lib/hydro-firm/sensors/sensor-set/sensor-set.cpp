@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <sensors/sensor-set/sensor-set.hpp>
+
+namespace Sensors {
+
+/*
+ * Constructor for a registry backed by the given array of slots
+ */
+SensorRegistry::SensorRegistry(Sensor **slots, const uint8_t capacity) : slots(slots), capacity(capacity) {}
+
+/*
+ * Register the sensor and assign it the next identifier.
+ */
+auto SensorRegistry::add(Sensor &sensor) -> SENSOR_ID {
+  if (this->count >= this->capacity) {
+    return INVALID_SENSOR_ID;
+  }
+  const SENSOR_ID sensorId = this->count;
+  sensor.setId(sensorId);
+  if (this->clock != nullptr) {
+    sensor.setClock(*this->clock);
+  }
+  this->slots[sensorId] = &sensor; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  ++this->count;
+  return sensorId;
+}
+
+/*
+ * Make every registered sensor, and every sensor registered later, wait on
+ * the given clock
+ */
+void SensorRegistry::setClock(Timing::Clock &clock) {
+  this->clock = &clock;
+  for (auto sensor : *this) {
+    sensor->setClock(clock); // LCOV_EXCL_BR_LINE
+  }
+}
+
+/*
+ * Get the sensor with the given identifier
+ */
+auto SensorRegistry::operator[](const SENSOR_ID sensorId) const -> Sensor * {
+  return this->slots[sensorId]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/*
+ * Get the number of registered sensors
+ */
+auto SensorRegistry::size() const -> uint8_t { return this->count; }
+
+/*
+ * Get the maximum number of sensors
+ */
+auto SensorRegistry::getCapacity() const -> uint8_t { return this->capacity; }
+
+/*
+ * Iterator to the first registered sensor
+ */
+auto SensorRegistry::begin() const -> Sensor *const * { return this->slots; }
+
+/*
+ * Iterator past the last registered sensor
+ */
+auto SensorRegistry::end() const -> Sensor *const * {
+  return this->slots + this->count; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+} // namespace Sensors
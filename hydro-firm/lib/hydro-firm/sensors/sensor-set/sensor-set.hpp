@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SENSORS_SENSOR_SET_SENSOR_SET_HPP
+#define SENSORS_SENSOR_SET_SENSOR_SET_HPP
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <sensors/sensor.hpp>
+
+namespace Sensors {
+
+/*
+ * Registry of the sensors to be read. Holds the sensors in a contiguous array
+ * provided by SensorSet and assigns each sensor its position as identifier.
+ */
+class SensorRegistry {
+
+private:
+  Sensor **const slots;
+  const uint8_t capacity;
+  uint8_t count = 0;
+  // Clock handed to every sensor, null for the hardware clock
+  Timing::Clock *clock = nullptr;
+
+protected:
+  /*
+   * Constructor for a registry backed by the given array of slots
+   */
+  explicit SensorRegistry(Sensor **slots, uint8_t capacity);
+
+public:
+  SensorRegistry(const SensorRegistry &) = delete;
+  auto operator=(const SensorRegistry &) -> SensorRegistry & = delete;
+
+  /*
+   * Register the sensor and assign it the next identifier. A sensor added
+   * after setClock() waits on that clock too. Returns INVALID_SENSOR_ID if
+   * the registry is full.
+   */
+  auto add(Sensor &sensor) -> SENSOR_ID;
+
+  /*
+   * Make every registered sensor, and every sensor registered later, wait on
+   * the given clock
+   */
+  void setClock(Timing::Clock &clock);
+
+  /*
+   * Get the sensor with the given identifier
+   */
+  auto operator[](SENSOR_ID sensorId) const -> Sensor *;
+
+  /*
+   * Get the number of registered sensors
+   */
+  auto size() const -> uint8_t;
+
+  /*
+   * Get the maximum number of sensors
+   */
+  auto getCapacity() const -> uint8_t;
+
+  /*
+   * Iterators over the registered sensors, in the order of their identifiers
+   */
+  auto begin() const -> Sensor *const *;
+  auto end() const -> Sensor *const *;
+};
+
+/*
+ * Storage for the slots of a SensorSet. Kept as a base class so that it is
+ * initialised before the registry that points into it.
+ */
+template <uint8_t N> struct SensorSetStorage {
+  std::array<Sensor *, N> slots = {};
+};
+
+/*
+ * Sensor registry with storage for N sensors sized at compile time, so that
+ * registering and iterating sensors does not allocate.
+ */
+template <uint8_t N> class SensorSet : private SensorSetStorage<N>, public SensorRegistry {
+  static_assert(N > 0 && N <= MAX_SENSORS, "SensorSet capacity must be between 1 and MAX_SENSORS");
+
+public:
+  /*
+   * Constructor for an empty set
+   */
+  SensorSet() : SensorRegistry(SensorSetStorage<N>::slots.data(), N) {}
+
+  /*
+   * Constructor registering the given sensors in order
+   */
+  SensorSet(std::initializer_list<Sensor *> sensors) : SensorSet() {
+    for (auto sensor : sensors) {
+      this->add(*sensor);
+    }
+  }
+};
+
+} // namespace Sensors
+
+#endif
@@ -29,7 +29,10 @@
  * @since: 08-09-2022
  */
 
+#include <algorithm>
+#include <array>
 #include <sensors/sensor.hpp>
+#include <timing/hardware-clock/hardware-clock.hpp>
 
 #ifdef NATIVE
 #include <ArduinoFake.h>
@@ -42,19 +45,30 @@ namespace Sensors {
 /*
  * Protected constructor for Sensors
  */
-Sensor::Sensor(const std::string &type, const SENSOR_TYPE isAnalogOrDigital, const uint8_t readPin,
+Sensor::Sensor(const char *const type, const SENSOR_TYPE isAnalogOrDigital, const uint8_t readPin,
                const uint8_t powerPin)
     : type(type), isAnalogOrDigital(isAnalogOrDigital), readPin(readPin), powerPin(powerPin), readDelay(DEFAULT_DELAY),
-      isPowerOnEnabled(ENABLE_POWER_ON) {
+      isPowerOnEnabled(ENABLE_POWER_ON), clock(&Timing::getHardwareClock()) {
+  this->setupSensor(); // LCOV_EXCL_BR_LINE
+}
+
+/*
+ * Protected constructor for Sensors with a custom delay between power on and
+ * reading
+ */
+Sensor::Sensor(const char *const type, const SENSOR_TYPE isAnalogOrDigital, const uint8_t readPin,
+               const uint8_t powerPin, const int16_t readDelay)
+    : type(type), isAnalogOrDigital(isAnalogOrDigital), readPin(readPin), powerPin(powerPin), readDelay(readDelay),
+      isPowerOnEnabled(ENABLE_POWER_ON), clock(&Timing::getHardwareClock()) {
   this->setupSensor(); // LCOV_EXCL_BR_LINE
 }
 
 /*
  * Protected constructor for Sensors
  */
-Sensor::Sensor(const std::string &type, const SENSOR_TYPE isAnalogOrDigital, const uint8_t readPin)
+Sensor::Sensor(const char *const type, const SENSOR_TYPE isAnalogOrDigital, const uint8_t readPin)
     : type(type), isAnalogOrDigital(isAnalogOrDigital), readPin(readPin), powerPin(-1), readDelay(DEFAULT_DELAY),
-      isPowerOnEnabled(DISABLE_POWER_ON) {
+      isPowerOnEnabled(DISABLE_POWER_ON), clock(&Timing::getHardwareClock()) {
   this->setupSensor(); // LCOV_EXCL_BR_LINE
 }
 
@@ -118,9 +132,20 @@ void Sensor::readSensor() {
 
   if (this->isPowerOnEnabled) {
     this->powerOnSensor();
-    delay(this->readDelay);
+    this->clock->delay(static_cast<uint32_t>(this->readDelay));
+  }
+
+  this->sampleSensor();
+
+  if (this->isPowerOnEnabled) {
+    this->powerOffSensor();
   }
+}
 
+/*
+ * Initialize and read the sensor without powering it on or off.
+ */
+void Sensor::sampleSensor() {
   this->initSensor();
 
   // Logger::verbose("Sensors>sensor", (String("Reading from sensor: ") +
@@ -131,19 +156,25 @@ void Sensor::readSensor() {
   } else {
     this->readDigitalSensor();
   }
-
-  if (this->isPowerOnEnabled) {
-    this->powerOffSensor();
-  }
 }
 
 /*
- * Read from analog sensor
+ * Read from analog sensor. With oversampling enabled the samples are taken back
+ * to back and combined with the configured filter.
  */
 void Sensor::readAnalogSensor() {
   // Logger::verbose("Sensors>sensor", (String("Reading from Analog sensor: ") +
   // this->type).c_str());
-  this->reading = analogRead(this->readPin);
+  if (this->sampleCount <= 1) {
+    this->reading = analogRead(this->readPin);
+    return;
+  }
+
+  std::array<int16_t, MAX_SAMPLE_COUNT> samples = {};
+  for (uint8_t index = 0; index < this->sampleCount; ++index) {
+    samples[index] = static_cast<int16_t>(analogRead(this->readPin));
+  }
+  this->reading = filterSamples(this->filterType, samples.data(), this->sampleCount);
 }
 
 /**
@@ -158,11 +189,69 @@ void Sensor::readDigitalSensor() {
 /**
  * Get the type of sensor
  */
-auto Sensor::getType() -> std::string { return this->type; }
+auto Sensor::getType() -> const char * { return this->type; }
+
+/**
+ * Checks if the sensor has to be powered on before reading
+ */
+auto Sensor::isPowerOnRequired() const -> bool { return this->isPowerOnEnabled; }
+
+/**
+ * Get the delay between powering on the sensor and reading the value
+ */
+auto Sensor::getReadDelay() const -> int16_t { return this->readDelay; }
+
+/**
+ * Get the pin the sensor is read from
+ */
+auto Sensor::getReadPin() const -> uint8_t { return this->readPin; }
 
 /**
  * Get the sensor reading
  */
 auto Sensor::getReading() const -> int { return this->reading; }
 
+/**
+ * Wait on the given clock between powering on and reading the sensor
+ */
+void Sensor::setClock(Timing::Clock &clock) { this->clock = &clock; }
+
+/**
+ * Set the identifier assigned to the sensor on registration
+ */
+void Sensor::setId(const SENSOR_ID sensorId) { this->id = sensorId; }
+
+/**
+ * Get the identifier assigned to the sensor on registration
+ */
+auto Sensor::getId() const -> SENSOR_ID { return this->id; }
+
+/**
+ * Set the analog multiplexer channel the sensor is read through
+ */
+void Sensor::setMuxChannel(const uint8_t channel) { this->muxChannel = channel; }
+
+/**
+ * Get the analog multiplexer channel the sensor is read through
+ */
+auto Sensor::getMuxChannel() const -> uint8_t { return this->muxChannel; }
+
+/**
+ * Set the number of analog samples per reading and the filter combining them
+ */
+void Sensor::setOversampling(const uint8_t sampleCount, const FILTER_TYPE filterType) {
+  this->sampleCount = std::min(std::max(sampleCount, static_cast<uint8_t>(1)), MAX_SAMPLE_COUNT);
+  this->filterType = filterType;
+}
+
+/**
+ * Get the number of analog samples taken per reading
+ */
+auto Sensor::getSampleCount() const -> uint8_t { return this->sampleCount; }
+
+/**
+ * Get the filter combining the analog samples
+ */
+auto Sensor::getFilterType() const -> FILTER_TYPE { return this->filterType; }
+
 } // namespace Sensors
@@ -33,19 +33,40 @@
 #define SENSORS_SENSOR_HPP
 
 #include <cstdint>
-#include <string>
+#include <sensors/filter/filter.hpp>
+#include <timing/clock/clock.hpp>
 
 namespace Sensors {
 
 enum SENSOR_TYPE { ANALOG, DIGITAL };
 
+// Compact identifier assigned to a sensor when it is registered for reading
+using SENSOR_ID = uint8_t;
+
+// Identifier of a sensor which is not registered
+const SENSOR_ID INVALID_SENSOR_ID = UINT8_MAX;
+
+// Sensor names are defined once, in the translation unit of the sensor, and
+// kept in flash on the target. Read them with the _P functions or FPSTR() there.
+#ifdef NATIVE
+#define SENSOR_NAME_STORAGE
+#else
+#define SENSOR_NAME_STORAGE PROGMEM
+#endif
+
+// Maximum number of sensors which can be registered for reading
+const uint8_t MAX_SENSORS = 64;
+
+// Multiplexer channel of a sensor wired directly to its read pin
+const uint8_t NO_MUX_CHANNEL = UINT8_MAX;
+
 class Sensor {
 
 private:
   static const int16_t DEFAULT_DELAY = 10;
 
-  // Sensor type
-  const std::string type;
+  // Sensor name, which also identifies the kind of sensor
+  const char *const type;
   // Is sensor Analog.pr digital
   const SENSOR_TYPE isAnalogOrDigital;
   // Pin for reading the sensor
@@ -57,18 +78,22 @@ private:
   // Enable powering on of sensor
   const bool isPowerOnEnabled;
 
-  // Sensor value
-  int reading = 0;
+  // Number of analog samples taken in one burst per reading
+  uint8_t sampleCount = 1;
+  // Filter combining the samples of a burst into the reading
+  FILTER_TYPE filterType = MEAN;
 
-  /*
-   * Power on the sensor
-   */
-  void powerOnSensor() const;
+  // Identifier assigned on registration
+  SENSOR_ID id = INVALID_SENSOR_ID;
 
-  /*
-   * Power off the sensor
-   */
-  void powerOffSensor() const;
+  // Channel of the analog multiplexer the sensor is read through
+  uint8_t muxChannel = NO_MUX_CHANNEL;
+
+  // Clock waited on between powering on and reading the sensor
+  Timing::Clock *clock;
+
+  // Sensor value
+  int reading = 0;
 
   /*
    * Read from analog sensor
@@ -99,6 +124,38 @@ public:
    */
   virtual void readSensor();
 
+  /*
+   * Initialize and read the sensor without powering it on or off. The caller
+   * is responsible for powering the sensor and waiting for it to settle.
+   */
+  virtual void sampleSensor();
+
+  /*
+   * Power on the sensor
+   */
+  void powerOnSensor() const;
+
+  /*
+   * Power off the sensor
+   */
+  void powerOffSensor() const;
+
+  /*
+   * Checks if the sensor has to be powered on before reading.
+   */
+  auto isPowerOnRequired() const -> bool;
+
+  /*
+   * Get the delay in milliseconds between powering on the sensor and reading
+   * the value.
+   */
+  auto getReadDelay() const -> int16_t;
+
+  /*
+   * Get the pin the sensor is read from
+   */
+  auto getReadPin() const -> uint8_t;
+
   /*
    * Initialize sensor before reading.
    */
@@ -110,25 +167,78 @@ public:
   virtual void resetSensor();
 
   /*
-   * Get the sensor type
+   * Get the sensor name. Sensors of one kind share the same name constant, so
+   * the pointer identifies the kind without comparing strings.
    */
-  virtual auto getType() -> std::string;
+  virtual auto getType() -> const char *;
 
   /*
    * Get the sensor reading value
    */
   virtual auto getReading() const -> int;
 
+  /*
+   * Wait on the given clock between powering on and reading the sensor
+   * instead of the hardware clock
+   */
+  void setClock(Timing::Clock &clock);
+
+  /*
+   * Set the identifier assigned to the sensor on registration
+   */
+  void setId(SENSOR_ID sensorId);
+
+  /*
+   * Get the identifier assigned to the sensor on registration
+   */
+  auto getId() const -> SENSOR_ID;
+
+  /*
+   * Set the analog multiplexer channel the sensor is read through. A sensor
+   * on a multiplexer is powered and sampled by the multiplexer scan.
+   */
+  void setMuxChannel(uint8_t channel);
+
+  /*
+   * Get the analog multiplexer channel the sensor is read through, or
+   * NO_MUX_CHANNEL for a sensor wired directly to its read pin
+   */
+  auto getMuxChannel() const -> uint8_t;
+
+  /*
+   * Take the given number of analog samples in a tight burst for every
+   * reading and combine them with the given filter. The sample count is
+   * limited to 1 - MAX_SAMPLE_COUNT.
+   */
+  void setOversampling(uint8_t sampleCount, FILTER_TYPE filterType);
+
+  /*
+   * Get the number of analog samples taken per reading
+   */
+  auto getSampleCount() const -> uint8_t;
+
+  /*
+   * Get the filter combining the analog samples
+   */
+  auto getFilterType() const -> FILTER_TYPE;
+
 protected:
   /*
    * Protected constructor for Sensors
    */
-  explicit Sensor(const std::string &type, SENSOR_TYPE isAnalogOrDigital, uint8_t readPin, uint8_t powerPin);
+  explicit Sensor(const char *type, SENSOR_TYPE isAnalogOrDigital, uint8_t readPin, uint8_t powerPin);
+
+  /*
+   * Protected constructor for Sensors with a custom delay between power on and
+   * reading
+   */
+  explicit Sensor(const char *type, SENSOR_TYPE isAnalogOrDigital, uint8_t readPin, uint8_t powerPin,
+                  int16_t readDelay);
 
   /*
    * Protected constructor for Sensors without power on & off functionality
    */
-  explicit Sensor(const std::string &type, SENSOR_TYPE isAnalogOrDigital, uint8_t readPin);
+  explicit Sensor(const char *type, SENSOR_TYPE isAnalogOrDigital, uint8_t readPin);
 };
 } // namespace Sensors
 
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SENSORS_STATIC_READ_SENSORS_STATIC_READ_SENSORS_HPP
+#define SENSORS_STATIC_READ_SENSORS_STATIC_READ_SENSORS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/sensor-set/sensor-set.hpp>
+#include <timing/hardware-clock/hardware-clock.hpp>
+#include <tuple>
+#include <type_traits>
+
+namespace Sensors {
+
+/*
+ * Registry of the sensors of a StaticReadSensors. Kept as a base class so
+ * that it is initialised before the ReadSensors that points to it.
+ */
+template <typename... SensorKinds> struct StaticSensorStorage {
+  SensorSet<sizeof...(SensorKinds)> sensorSet;
+
+  explicit StaticSensorStorage(SensorKinds &...sensors) : sensorSet{&sensors...} {}
+};
+
+/*
+ * Reads a fixed list of sensors whose kinds are template parameters. Every
+ * sensor is called by its own static type, so final sensor classes are read
+ * without virtual calls and mock sensors keep the test seams. The readings
+ * are published like ReadSensors does, so State and both processes read them
+ * as usual. Sensors on an analog multiplexer are not supported.
+ */
+template <typename... SensorKinds>
+class StaticReadSensors final : private StaticSensorStorage<SensorKinds...>, public ReadSensors {
+  static_assert(sizeof...(SensorKinds) > 0, "StaticReadSensors needs at least one sensor");
+
+private:
+  std::tuple<SensorKinds &...> sensorKinds;
+
+  /*
+   * Read a sensor with its own power on, read delay and power off
+   */
+  struct ReadSensor {
+    ReadingSnapshot *snapshot;
+    template <typename SensorKind> void operator()(SensorKind &sensor) const {
+      sensor.readSensor();
+      snapshot->readings[sensor.getId()] = sensor.getReading();
+    }
+  };
+
+  /*
+   * Power on a sensor and track the longest read delay
+   */
+  struct PowerOnSensor {
+    int16_t *readDelay;
+    template <typename SensorKind> void operator()(SensorKind &sensor) const {
+      if (sensor.isPowerOnRequired()) {
+        sensor.powerOnSensor();
+        *readDelay = std::max(*readDelay, sensor.getReadDelay());
+      }
+    }
+  };
+
+  /*
+   * Sample a powered sensor
+   */
+  struct SampleSensor {
+    ReadingSnapshot *snapshot;
+    template <typename SensorKind> void operator()(SensorKind &sensor) const {
+      sensor.sampleSensor();
+      snapshot->readings[sensor.getId()] = sensor.getReading();
+    }
+  };
+
+  /*
+   * Power off a sensor
+   */
+  struct PowerOffSensor {
+    template <typename SensorKind> void operator()(SensorKind &sensor) const {
+      if (sensor.isPowerOnRequired()) {
+        sensor.powerOffSensor();
+      }
+    }
+  };
+
+  /*
+   * Apply the visitor to the sensors from the given index on, unrolled at
+   * compile time
+   */
+  template <size_t INDEX, typename Visitor>
+  auto visitSensors(const Visitor &visitor) -> typename std::enable_if<(INDEX < sizeof...(SensorKinds))>::type {
+    visitor(std::get<INDEX>(this->sensorKinds));
+    this->template visitSensors<INDEX + 1>(visitor);
+  }
+
+  template <size_t INDEX, typename Visitor>
+  auto visitSensors(const Visitor & /*visitor*/) -> typename std::enable_if<(INDEX == sizeof...(SensorKinds))>::type {}
+
+public:
+  /*
+   * Constructor registering the given sensors in order
+   */
+  explicit StaticReadSensors(SensorKinds &...sensors, READ_MODE readMode = SEQUENTIAL,
+                             Timing::Clock &clock = Timing::getHardwareClock())
+      : StaticSensorStorage<SensorKinds...>(sensors...),
+        ReadSensors(StaticSensorStorage<SensorKinds...>::sensorSet, readMode, clock), sensorKinds(sensors...) {}
+
+  /*
+   * Read all sensors in the configured read mode and publish the readings
+   */
+  void readAllSensors() override {
+    ReadingSnapshot &backSnapshot = this->getBackSnapshot();
+    if (this->getReadMode() == BATCHED) {
+      int16_t readDelay = -1;
+      this->template visitSensors<0>(PowerOnSensor{&readDelay});
+      if (readDelay >= 0) {
+        this->getClock().delay(static_cast<uint32_t>(readDelay));
+      }
+      this->template visitSensors<0>(SampleSensor{&backSnapshot});
+      this->template visitSensors<0>(PowerOffSensor{});
+    } else {
+      this->template visitSensors<0>(ReadSensor{&backSnapshot});
+    }
+    this->publishSnapshot();
+  }
+};
+
+} // namespace Sensors
+
+#endif
@@ -31,10 +31,19 @@
 
 #include <sensors/water-level/water-level.hpp>
 
+#ifndef NATIVE
+#include <Arduino.h>
+#endif
+
 namespace Sensors {
+
+const char WATER_LEVEL_SENSOR[] SENSOR_NAME_STORAGE = "Water Level Sensor";
+
 /*
  * Constructor for setting Read Pin, Power Pin and Delay
  */
 WaterLevelSensor::WaterLevelSensor(uint8_t readPin, uint8_t powerPin)
-    : Sensor(WATER_LEVEL_SENSOR, WATER_LEVEL_TYPE, readPin, powerPin) {}
+    : Sensor(WATER_LEVEL_SENSOR, WATER_LEVEL_TYPE, readPin, powerPin) {
+  this->setOversampling(WATER_LEVEL_SAMPLE_COUNT, WATER_LEVEL_FILTER);
+}
 } // namespace Sensors
@@ -36,10 +36,15 @@
 
 namespace Sensors {
 
-static const std::string WATER_LEVEL_SENSOR = "Water Level Sensor";
+// Name of the water level sensor, kept in flash on the target
+extern const char WATER_LEVEL_SENSOR[];
 static const SENSOR_TYPE WATER_LEVEL_TYPE = ANALOG;
+// Water level is compared against the thresholds as is, so ADC noise is removed
+// with a median over a burst of samples
+static const uint8_t WATER_LEVEL_SAMPLE_COUNT = 9;
+static const FILTER_TYPE WATER_LEVEL_FILTER = MEDIAN;
 
-class WaterLevelSensor : public Sensors::Sensor {
+class WaterLevelSensor final : public Sensors::Sensor {
 
 public:
   /*
@@ -0,0 +1,146 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifdef NATIVE
+
+#include <algorithm>
+#include <sensors/moisture-level/moisture-level.hpp>
+#include <sensors/water-level/water-level.hpp>
+#include <simulator/simulation/simulation.hpp>
+
+/*
+ * Constructor
+ */
+Simulator::SimulatedSensor::SimulatedSensor(const char *type, const uint8_t readPin, const TankModel &model,
+                                            int (TankModel::*quantity)() const)
+    : Sensors::Sensor(type, Sensors::ANALOG, readPin), model(&model), quantity(quantity) {}
+
+/*
+ * Take the current quantity from the model
+ */
+void Simulator::SimulatedSensor::sampleSensor() { this->value = (this->model->*this->quantity)(); }
+
+/*
+ * Get the last sampled quantity
+ */
+auto Simulator::SimulatedSensor::getReading() const -> int { return this->value; }
+
+/*
+ * Constructor
+ */
+Simulator::SimulatedController::SimulatedController(System::State &state, TankModel &model)
+    : System::Controller(state), model(&model) {}
+
+/*
+ * Switch the pump and valve of the tank model along with the outputs
+ */
+void Simulator::SimulatedController::writeOutputs(const uint8_t actuators, const uint8_t changed) {
+  System::Controller::writeOutputs(actuators, changed);
+  this->model->setPumpOn(System::hasBit(actuators, System::PUMP_ON_BIT));
+  this->model->setValveClosed(System::hasBit(actuators, System::VALVE_CLOSED_BIT));
+}
+
+/*
+ * Constructor
+ */
+Simulator::Simulation::Simulation(const TankParameters &tank, const uint32_t coolDownPeriod)
+    : model(tank),
+      waterLevelSensor(Sensors::WATER_LEVEL_SENSOR, WATER_LEVEL_PIN, this->model, &TankModel::getWaterLevelReading),
+      moistureLevelSensor(Sensors::MOISTURE_LEVEL_SENSOR, MOISTURE_LEVEL_PIN, this->model,
+                          &TankModel::getMoistureReading),
+      sensors{&this->waterLevelSensor, &this->moistureLevelSensor},
+      readSensors(this->sensors, Sensors::BATCHED, this->clock), state(this->readSensors),
+      controller(this->state, this->model), systemProcess(this->controller, this->state),
+      dataProcess(this->readSensors, this->clock),
+      executor(this->readSensors, this->systemProcess, this->dataProcess, this->clock),
+      coolDownPeriod(coolDownPeriod) {}
+
+/*
+ * Reset the cool down mode once it lasted for the cool down period
+ */
+void Simulator::Simulation::updateCoolDown() {
+  if (this->coolDownPeriod == 0 || !this->state.isCoolDownState()) {
+    this->isCoolingDown = false;
+    return;
+  }
+  if (!this->isCoolingDown) {
+    this->isCoolingDown = true;
+    this->coolDownStart = this->clock.millis();
+  } else if (this->clock.millis() - this->coolDownStart >= this->coolDownPeriod) {
+    this->state.resetCoolDownState();
+    this->isCoolingDown = false;
+  }
+}
+
+/*
+ * Run the control loop for the given number of milliseconds of virtual time
+ */
+void Simulator::Simulation::run(const uint32_t duration) {
+  uint32_t elapsed = 0;
+  while (elapsed < duration) {
+    this->executor.loop();
+    this->updateCoolDown();
+
+    // Jump to the next deadline, the actuators staying as they are until then
+    const uint32_t untilNextTask = this->executor.timeUntilNextTask(this->clock.millis());
+    const uint32_t step = std::min(std::max(untilNextTask, 1U), duration - elapsed);
+    this->report.modeMillis.at(this->state.getMode()) += step;
+    if (this->model.isPumpOn()) {
+      this->report.pumpOnMillis += step;
+    }
+    this->model.advance(step);
+    this->clock.advance(step);
+    elapsed += step;
+  }
+
+  this->report.simulatedMillis += elapsed;
+  this->report.pumpCycles = this->model.getPumpStarts();
+  this->report.overflowEvents = this->model.getOverflowEvents();
+  this->report.spilledVolume = this->model.getSpilledVolume();
+  this->report.evaluatedPasses = this->systemProcess.getEvaluatedPasses();
+  this->report.skippedPasses = this->systemProcess.getSkippedPasses();
+}
+
+/*
+ * Get the outcome of all runs so far
+ */
+auto Simulator::Simulation::getReport() const -> const SimulationReport & { return this->report; }
+
+/*
+ * Get the tank model
+ */
+auto Simulator::Simulation::getModel() const -> const TankModel & { return this->model; }
+
+/*
+ * Get the data process, to attach sample sinks
+ */
+auto Simulator::Simulation::getDataProcess() -> Data::Process & { return this->dataProcess; }
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SIMULATOR_SIMULATION_SIMULATION_HPP
+#define SIMULATOR_SIMULATION_SIMULATION_HPP
+
+#ifdef NATIVE
+
+#include <array>
+#include <cstdint>
+#include <data/process/process.hpp>
+#include <executor/executor.hpp>
+#include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/sensor-set/sensor-set.hpp>
+#include <sensors/sensor.hpp>
+#include <simulator/tank-model/tank-model.hpp>
+#include <system/controller/controller.hpp>
+#include <system/process/process.hpp>
+#include <system/state/state.hpp>
+#include <timing/virtual-clock/virtual-clock.hpp>
+
+namespace Simulator {
+
+// Pins of the simulated sensors. The readings come from the model, so the
+// pins only tell the sensors apart.
+const uint8_t WATER_LEVEL_PIN = 1;
+const uint8_t MOISTURE_LEVEL_PIN = 2;
+
+const uint32_t HOUR_MILLIS = 3600000;
+const uint32_t DAY_MILLIS = 24 * HOUR_MILLIS;
+
+/*
+ * Sensor sampling one quantity of the tank model
+ */
+class SimulatedSensor : public Sensors::Sensor {
+
+private:
+  const TankModel *model;
+  int (TankModel::*const quantity)() const;
+  int value = 0;
+
+public:
+  /*
+   * Constructor for a sensor of the given type reading the quantity of the
+   * model
+   */
+  explicit SimulatedSensor(const char *type, uint8_t readPin, const TankModel &model,
+                           int (TankModel::*quantity)() const);
+
+  /*
+   * Take the current quantity from the model
+   */
+  void sampleSensor() override;
+
+  /*
+   * Get the last sampled quantity
+   */
+  auto getReading() const -> int override;
+};
+
+/*
+ * Controller switching the pump and valve of the tank model
+ */
+class SimulatedController : public System::Controller {
+
+private:
+  TankModel *model;
+
+protected:
+  /*
+   * Switch the pump and valve of the tank model along with the outputs
+   */
+  void writeOutputs(uint8_t actuators, uint8_t changed) override;
+
+public:
+  /*
+   * Constructor
+   */
+  explicit SimulatedController(System::State &state, TankModel &model);
+};
+
+/*
+ * Outcome of a simulation
+ */
+struct SimulationReport {
+  uint64_t simulatedMillis;
+  uint32_t pumpCycles;
+  uint64_t pumpOnMillis;
+  // Time spent in each System::SYSTEM_MODE
+  std::array<uint64_t, System::MODE_COUNT> modeMillis;
+  uint32_t overflowEvents;
+  float spilledVolume;
+  uint32_t evaluatedPasses;
+  uint32_t skippedPasses;
+};
+
+/*
+ * Runs the firmware's control loop against a tank model on a virtual clock.
+ * Time jumps from one task deadline of the executor to the next, and the
+ * model advances over each jump in one step, so a month of operation takes
+ * seconds.
+ *
+ * The firmware does not leave the cool down mode on its own yet. With a
+ * cool down period the simulation resets the cool down mode after that
+ * period, standing in for the missing timer.
+ */
+class Simulation {
+
+private:
+  TankModel model;
+  Timing::VirtualClock clock;
+  SimulatedSensor waterLevelSensor;
+  SimulatedSensor moistureLevelSensor;
+  Sensors::SensorSet<2> sensors;
+  Sensors::ReadSensors readSensors;
+  System::State state;
+  SimulatedController controller;
+  System::Process systemProcess;
+  Data::Process dataProcess;
+  MainExecutor::Executor executor;
+  const uint32_t coolDownPeriod;
+  uint32_t coolDownStart = 0;
+  bool isCoolingDown = false;
+  SimulationReport report = {};
+
+  /*
+   * Reset the cool down mode once it lasted for the cool down period
+   */
+  void updateCoolDown();
+
+public:
+  /*
+   * Constructor for a simulation of the given container. A cool down period
+   * of zero keeps the firmware's behaviour of never leaving cool down.
+   */
+  explicit Simulation(const TankParameters &tank = DEFAULT_TANK, uint32_t coolDownPeriod = 0);
+
+  /*
+   * Run the control loop for the given number of milliseconds of virtual
+   * time
+   */
+  void run(uint32_t duration);
+
+  /*
+   * Get the outcome of all runs so far
+   */
+  auto getReport() const -> const SimulationReport &;
+
+  /*
+   * Get the tank model
+   */
+  auto getModel() const -> const TankModel &;
+
+  /*
+   * Get the data process, to attach sample sinks
+   */
+  auto getDataProcess() -> Data::Process &;
+};
+
+} // namespace Simulator
+
+#endif
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifdef NATIVE
+
+#include <algorithm>
+#include <cmath>
+#include <simulator/tank-model/tank-model.hpp>
+
+namespace {
+
+const float MILLIS_PER_SECOND = 1000.0F;
+
+} // namespace
+
+/*
+ * Constructor
+ */
+Simulator::TankModel::TankModel(const TankParameters &parameters)
+    : parameters(parameters), moisture(parameters.initialMoisture) {}
+
+/*
+ * Advance the model by the given number of milliseconds
+ */
+void Simulator::TankModel::advance(const uint32_t milliseconds) {
+  const float seconds = static_cast<float>(milliseconds) / MILLIS_PER_SECOND;
+  const float inflow = this->pumpOn ? this->parameters.pumpFlow : 0.0F;
+  const float outflow = this->valveClosed ? 0.0F : this->parameters.drainFlow;
+  this->volume += (inflow - outflow) * seconds;
+  if (this->volume > this->parameters.capacity) {
+    this->spilledVolume += this->volume - this->parameters.capacity;
+    this->volume = this->parameters.capacity;
+    if (!this->overflowing) {
+      this->overflowing = true;
+      ++this->overflowEvents;
+    }
+  } else {
+    this->overflowing = false;
+    this->volume = std::max(this->volume, 0.0F);
+  }
+
+  // The moisture settles exponentially towards saturation while the water
+  // reaches the substrate and towards dry otherwise
+  const bool isSoaking = this->volume >= this->parameters.soakLevel * this->parameters.capacity;
+  const float target = isSoaking ? static_cast<float>(MOISTURE_FULL_SCALE) : 0.0F;
+  const float timeConstant = isSoaking ? this->parameters.wettingTime : this->parameters.dryingTime;
+  this->moisture = target + (this->moisture - target) * std::exp(-seconds / timeConstant);
+}
+
+/*
+ * Switch the pump on or off
+ */
+void Simulator::TankModel::setPumpOn(const bool isPumpOn) {
+  if (isPumpOn && !this->pumpOn) {
+    ++this->pumpStarts;
+  }
+  this->pumpOn = isPumpOn;
+}
+
+/*
+ * Close or open the valve
+ */
+void Simulator::TankModel::setValveClosed(const bool isValveClosed) { this->valveClosed = isValveClosed; }
+
+/*
+ * Get the reading of a water level sensor
+ */
+auto Simulator::TankModel::getWaterLevelReading() const -> int {
+  return static_cast<int>(this->volume / this->parameters.capacity * static_cast<float>(WATER_LEVEL_FULL_SCALE));
+}
+
+/*
+ * Get the reading of a moisture sensor
+ */
+auto Simulator::TankModel::getMoistureReading() const -> int { return static_cast<int>(this->moisture); }
+
+/*
+ * Get the volume of water in the container in litres
+ */
+auto Simulator::TankModel::getVolume() const -> float { return this->volume; }
+
+/*
+ * Checks if the pump is on
+ */
+auto Simulator::TankModel::isPumpOn() const -> bool { return this->pumpOn; }
+
+/*
+ * Get the number of times the pump was switched on
+ */
+auto Simulator::TankModel::getPumpStarts() const -> uint32_t { return this->pumpStarts; }
+
+/*
+ * Get the number of times the container started to overflow
+ */
+auto Simulator::TankModel::getOverflowEvents() const -> uint32_t { return this->overflowEvents; }
+
+/*
+ * Get the volume spilled by overflows in litres
+ */
+auto Simulator::TankModel::getSpilledVolume() const -> float { return this->spilledVolume; }
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SIMULATOR_TANK_MODEL_TANK_MODEL_HPP
+#define SIMULATOR_TANK_MODEL_TANK_MODEL_HPP
+
+#ifdef NATIVE
+
+#include <cstdint>
+
+namespace Simulator {
+
+// Water level reading of a full container. The maximum allowed water level of
+// System::State is reached at five sixths of the capacity.
+const int WATER_LEVEL_FULL_SCALE = 12;
+
+// Moisture reading of a saturated substrate, in percent
+const int MOISTURE_FULL_SCALE = 100;
+
+/*
+ * Physical parameters of a plant container
+ */
+struct TankParameters {
+  // Volume of the container in litres
+  float capacity;
+  // Flow of the pump into the container in litres per second
+  float pumpFlow;
+  // Flow out of the container through the open valve in litres per second
+  float drainFlow;
+  // Fraction of the capacity from which the water reaches the substrate
+  float soakLevel;
+  // Time constant of the substrate soaking up water, in seconds
+  float wettingTime;
+  // Time constant of the substrate drying out, in seconds
+  float dryingTime;
+  // Moisture of the substrate at the start, in percent
+  float initialMoisture;
+};
+
+// A 20 litre container filled in about five and a half minutes, with a
+// substrate drying out over a few days
+const TankParameters DEFAULT_TANK = {20.0F, 0.05F, 0.02F, 0.25F, 600.0F, 86400.0F, 50.0F};
+
+/*
+ * Plant container with a pump filling it, a valve draining it and a substrate
+ * whose moisture follows the water level. Flows are constant between two
+ * actuator changes, so the model advances over any interval in one step.
+ */
+class TankModel {
+
+private:
+  const TankParameters parameters;
+  float volume = 0.0F;
+  float moisture;
+  bool pumpOn = false;
+  bool valveClosed = false;
+  bool overflowing = false;
+  uint32_t pumpStarts = 0;
+  uint32_t overflowEvents = 0;
+  float spilledVolume = 0.0F;
+
+public:
+  /*
+   * Constructor for an empty container with the pump off and the valve open
+   */
+  explicit TankModel(const TankParameters &parameters);
+
+  /*
+   * Advance the model by the given number of milliseconds
+   */
+  void advance(uint32_t milliseconds);
+
+  /*
+   * Switch the pump on or off
+   */
+  void setPumpOn(bool isPumpOn);
+
+  /*
+   * Close or open the valve
+   */
+  void setValveClosed(bool isValveClosed);
+
+  /*
+   * Get the reading of a water level sensor, from zero for an empty container
+   * to WATER_LEVEL_FULL_SCALE for a full one
+   */
+  auto getWaterLevelReading() const -> int;
+
+  /*
+   * Get the reading of a moisture sensor, in percent
+   */
+  auto getMoistureReading() const -> int;
+
+  /*
+   * Get the volume of water in the container in litres
+   */
+  auto getVolume() const -> float;
+
+  /*
+   * Checks if the pump is on
+   */
+  auto isPumpOn() const -> bool;
+
+  /*
+   * Get the number of times the pump was switched on
+   */
+  auto getPumpStarts() const -> uint32_t;
+
+  /*
+   * Get the number of times the container started to overflow
+   */
+  auto getOverflowEvents() const -> uint32_t;
+
+  /*
+   * Get the volume spilled by overflows in litres
+   */
+  auto getSpilledVolume() const -> float;
+};
+
+} // namespace Simulator
+
+#endif
+
+#endif
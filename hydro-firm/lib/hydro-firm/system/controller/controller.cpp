@@ -36,37 +36,69 @@ namespace System {
 /*
  * Constructor.
  */
-Controller::Controller(State &state) : state(&state) {}
+Controller::Controller(State &state, const uint8_t pumpPin, const uint8_t valvePin)
+    : state(&state), pumpMask(outputMask(pumpPin)), valveMask(outputMask(valvePin)) {}
+
+/*
+ * Set the outputs up with the pump off and the valve open
+ */
+void Controller::begin() const { setUpOutputs(this->pumpMask | this->valveMask); }
 
 /*
  * Turn On Pump.
  */
-void Controller::turnOnPump() {
-  if (!state->isPumpOn()) {
-  }
-}
+void Controller::turnOnPump() { this->request(PUMP_ON_BIT, true); }
 
 /*
  * Turn Off Pump.
  */
-void Controller::turnOffPump() {
-  if (state->isPumpOn()) {
-  }
-}
+void Controller::turnOffPump() { this->request(PUMP_ON_BIT, false); }
 
 /*
  * Close Valve.
  */
-void Controller::closeValve() {
-  if (!state->isValveClosed()) {
-  }
-}
+void Controller::closeValve() { this->request(VALVE_CLOSED_BIT, true); }
 
 /*
  * Open valve.
  */
-void Controller::openValve() {
-  if (state->isValveClosed()) {
+void Controller::openValve() { this->request(VALVE_CLOSED_BIT, false); }
+
+/*
+ * Write the net change of the commands since the last call. The state takes
+ * the pump and the valve in a single update.
+ */
+void Controller::applyCommands() {
+  const auto changed = static_cast<uint8_t>(this->appliedActuators ^ this->requestedActuators);
+  if (changed == 0) {
+    return;
   }
+  this->writeOutputs(this->requestedActuators, changed);
+  this->appliedActuators = this->requestedActuators;
+  ++this->outputWrites;
+  this->state->setActuators(hasBit(this->appliedActuators, PUMP_ON_BIT),
+                            hasBit(this->appliedActuators, VALVE_CLOSED_BIT));
+}
+
+/*
+ * Get the number of passes which changed the outputs
+ */
+auto Controller::getOutputWrites() const -> uint32_t { return this->outputWrites; }
+
+/*
+ * Request the actuator bit set or cleared at the end of the pass
+ */
+void Controller::request(const uint8_t bit, const bool value) {
+  const unsigned cleared = static_cast<unsigned>(this->requestedActuators) & ~static_cast<unsigned>(bit);
+  this->requestedActuators = static_cast<uint8_t>(value ? cleared | bit : cleared);
+}
+
+/*
+ * Drive the changed outputs, the pump and valve outputs in one write each way
+ */
+void Controller::writeOutputs(const uint8_t actuators, const uint8_t changed) {
+  OutputWrite write;
+  write.addActuators(actuators, changed, this->pumpMask, this->valveMask);
+  write.apply();
 }
-} // namespace System
\ No newline at end of file
+} // namespace System
@@ -32,19 +32,55 @@
 #ifndef SYSTEM_CONTROLLER_CONTROLLER_HPP
 #define SYSTEM_CONTROLLER_CONTROLLER_HPP
 
+#include <cstdint>
+#include <system/outputs/outputs.hpp>
 #include <system/state/state.hpp>
 
 namespace System {
+
+/*
+ * Switches the pump and the valve. The commands of a pass only record the
+ * intended actuator states; applyCommands() at the end of the pass writes the
+ * net change to the outputs at once and updates the state, so commands which
+ * cancel out or repeat the current state never toggle a relay.
+ */
 class Controller {
 
 private:
   State *state;
+  // Output masks of the actuators, zero when not wired
+  const uint32_t pumpMask;
+  const uint32_t valveMask;
+  // PUMP_ON_BIT and VALVE_CLOSED_BIT as written to the outputs, and as
+  // requested by the commands of the current pass
+  uint8_t appliedActuators = 0;
+  uint8_t requestedActuators = 0;
+  // Number of passes which changed the outputs
+  uint32_t outputWrites = 0;
+
+  /*
+   * Request the actuator bit set or cleared at the end of the pass
+   */
+  void request(uint8_t bit, bool value);
+
+protected:
+  /*
+   * Drive the outputs to the given actuator bits. Only called when a bit in
+   * changed differs from the outputs.
+   */
+  virtual void writeOutputs(uint8_t actuators, uint8_t changed);
 
 public:
   /*
-   * Constructor.
+   * Constructor. The pump and valve outputs are driven high while the pump
+   * runs and while the valve is closed.
    */
-  explicit Controller(State &state);
+  explicit Controller(State &state, uint8_t pumpPin = NO_OUTPUT_PIN, uint8_t valvePin = NO_OUTPUT_PIN);
+
+  /*
+   * Set the outputs up with the pump off and the valve open
+   */
+  void begin() const;
 
   /*
    * Turn On Pump.
@@ -65,8 +101,20 @@ public:
    * Open valve.
    */
   virtual void openValve();
+
+  /*
+   * Write the net change of the commands since the last call to the outputs
+   * and the state. Does nothing if the commands left the actuators as they
+   * are.
+   */
+  virtual void applyCommands();
+
+  /*
+   * Get the number of passes which changed the outputs
+   */
+  auto getOutputWrites() const -> uint32_t;
 };
 
 } // namespace System
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SYSTEM_DECISION_TABLE_DECISION_TABLE_HPP
+#define SYSTEM_DECISION_TABLE_DECISION_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace System {
+
+/*
+ * Mode of the watering cycle. The system starts by forcing a watering cycle,
+ * then alternates between the active and cool down modes.
+ */
+enum SYSTEM_MODE { FORCED_WATERING_MODE, ACTIVE_MODE, COOL_DOWN_MODE };
+
+// Number of modes
+const uint8_t MODE_COUNT = 3;
+
+/*
+ * Layout of the packed state word. The low bits are left free for the
+ * threshold bits, so the mode and watering cycle bits of the word combined
+ * with the threshold bits form the decision index.
+ */
+const uint8_t MOISTURE_LEVEL_MIN_BIT = 0x01;
+const uint8_t WATER_LEVEL_MIN_BIT = 0x02;
+const uint8_t WATER_LEVEL_MAX_BIT = 0x04;
+const uint8_t WATERING_CYCLE_BIT = 0x08;
+const uint8_t MODE_SHIFT = 4;
+const uint8_t MODE_MASK = 0x30;
+const uint8_t PUMP_ON_BIT = 0x40;
+const uint8_t VALVE_CLOSED_BIT = 0x80;
+
+// Bits of the state word the decisions depend on
+const uint8_t DECISION_STATE_MASK = MODE_MASK | WATERING_CYCLE_BIT;
+
+// Number of decision indexes, one per mode and combination of the low bits
+const uint8_t DECISION_TABLE_SIZE = MODE_COUNT << MODE_SHIFT;
+
+/*
+ * Action taken by one evaluation of the control logic
+ */
+enum ACTION { NO_ACTION, CLOSE_VALVE, DRAIN_WATER, FILL_WATER };
+
+/*
+ * Build the decision index of a mode and its watering cycle and threshold
+ * bits
+ */
+constexpr auto decisionIndex(SYSTEM_MODE mode, uint8_t bits) -> uint8_t {
+  return static_cast<uint8_t>((static_cast<unsigned>(mode) << MODE_SHIFT) | bits);
+}
+
+/*
+ * Checks if the bit is set in the value
+ */
+constexpr auto hasBit(uint8_t value, uint8_t bit) -> bool { return (static_cast<unsigned>(value) & bit) != 0U; }
+
+/*
+ * Cool down: keep the valve closed once the container is drained, otherwise
+ * keep draining.
+ */
+constexpr auto decideCoolDown(uint8_t index) -> ACTION {
+  return hasBit(index, WATER_LEVEL_MIN_BIT) ? CLOSE_VALVE : DRAIN_WATER;
+}
+
+/*
+ * Active: drain a full container, start a watering cycle when the container
+ * is empty and the plants are dry, and keep the valve closed outside of a
+ * watering cycle.
+ */
+constexpr auto decideActive(uint8_t index) -> ACTION {
+  return hasBit(index, WATER_LEVEL_MAX_BIT)    ? DRAIN_WATER
+         : hasBit(index, WATER_LEVEL_MIN_BIT)  ? (hasBit(index, MOISTURE_LEVEL_MIN_BIT) ? FILL_WATER : CLOSE_VALVE)
+         : !hasBit(index, WATERING_CYCLE_BIT) ? CLOSE_VALVE
+                                               : NO_ACTION;
+}
+
+/*
+ * Forced watering: fill the container until it is full, then drain it.
+ */
+constexpr auto decideForcedWatering(uint8_t index) -> ACTION {
+  return hasBit(index, WATER_LEVEL_MAX_BIT) ? DRAIN_WATER : FILL_WATER;
+}
+
+/*
+ * Action for a decision index
+ */
+constexpr auto decide(uint8_t index) -> ACTION {
+  return (index >> MODE_SHIFT) == COOL_DOWN_MODE ? decideCoolDown(index)
+         : (index >> MODE_SHIFT) == ACTIVE_MODE  ? decideActive(index)
+                                                 : decideForcedWatering(index);
+}
+
+/*
+ * Compile time list of the decision indexes, used to expand decide() over
+ * the whole table
+ */
+template <uint8_t... I> struct DecisionIndexes {};
+template <uint8_t N, uint8_t... I> struct MakeDecisionIndexes : MakeDecisionIndexes<N - 1, N - 1, I...> {};
+template <uint8_t... I> struct MakeDecisionIndexes<0, I...> {
+  using type = DecisionIndexes<I...>;
+};
+
+/*
+ * Evaluate decide() for every index of the list
+ */
+template <uint8_t... I>
+constexpr auto buildDecisionTable(DecisionIndexes<I...> /*indexes*/) -> std::array<ACTION, sizeof...(I)> {
+  return {{decide(I)...}};
+}
+
+/*
+ * Action for every decision index, computed at compile time. One evaluation
+ * of the control logic is a single lookup.
+ */
+constexpr std::array<ACTION, DECISION_TABLE_SIZE> DECISION_TABLE =
+    buildDecisionTable(MakeDecisionIndexes<DECISION_TABLE_SIZE>::type());
+
+// Bits of the state word an action can change
+const uint8_t ACTION_STATE_MASK = MODE_MASK | WATERING_CYCLE_BIT | PUMP_ON_BIT | VALVE_CLOSED_BIT;
+
+/*
+ * State word with the given bits set
+ */
+constexpr auto setBits(uint8_t word, unsigned bits) -> uint8_t {
+  return static_cast<uint8_t>(static_cast<unsigned>(word) | bits);
+}
+
+/*
+ * State word with the pump off, the valve open, no watering cycle and the
+ * cool down mode
+ */
+constexpr auto drainedState(uint8_t word) -> uint8_t {
+  return setBits(static_cast<uint8_t>(static_cast<unsigned>(word) & ~static_cast<unsigned>(ACTION_STATE_MASK)),
+                 decisionIndex(COOL_DOWN_MODE, 0));
+}
+
+/*
+ * State word after the action, with the pump and valve bits following the
+ * actuators. Closing the valve keeps the rest, filling closes the valve and
+ * starts the pump and the watering cycle, draining is drainedState().
+ */
+constexpr auto applyAction(uint8_t word, ACTION action) -> uint8_t {
+  return action == CLOSE_VALVE   ? setBits(word, VALVE_CLOSED_BIT)
+         : action == FILL_WATER  ? setBits(word, VALVE_CLOSED_BIT | PUMP_ON_BIT | WATERING_CYCLE_BIT)
+         : action == DRAIN_WATER ? drainedState(word)
+                                 : word;
+}
+
+} // namespace System
+
+#endif
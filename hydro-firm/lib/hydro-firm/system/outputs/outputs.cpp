@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <system/decision-table/decision-table.hpp>
+#include <system/outputs/outputs.hpp>
+
+#ifdef NATIVE
+#include <ArduinoFake.h>
+#else
+#include <Arduino.h>
+#endif
+
+/*
+ * Set the outputs in the mask up, driven low
+ */
+void System::setUpOutputs(const uint32_t mask) {
+  for (uint8_t pin = 0; pin <= MAX_OUTPUT_PIN; ++pin) {
+    if ((mask & outputMask(pin)) != 0) {
+      pinMode(pin, OUTPUT);
+    }
+  }
+  OutputWrite write;
+  write.clear(mask);
+  write.apply();
+}
+
+/*
+ * Add the changed pump and valve outputs
+ */
+void System::OutputWrite::addActuators(const uint8_t actuators, const uint8_t changed, const uint32_t pumpMask,
+                                       const uint32_t valveMask) {
+  if (hasBit(changed, PUMP_ON_BIT)) {
+    (hasBit(actuators, PUMP_ON_BIT) ? this->setMask : this->clearMask) |= pumpMask;
+  }
+  if (hasBit(changed, VALVE_CLOSED_BIT)) {
+    (hasBit(actuators, VALVE_CLOSED_BIT) ? this->setMask : this->clearMask) |= valveMask;
+  }
+}
+
+/*
+ * Add the outputs in the mask, driven low
+ */
+void System::OutputWrite::clear(const uint32_t mask) { this->clearMask |= mask; }
+
+/*
+ * Drive the collected outputs. On the ESP8266 each mask is a single write to
+ * the GPIO set or clear register.
+ */
+void System::OutputWrite::apply() const {
+#ifdef NATIVE
+  for (uint8_t pin = 0; pin <= MAX_OUTPUT_PIN; ++pin) {
+    if ((this->setMask & outputMask(pin)) != 0) {
+      digitalWrite(pin, HIGH);
+    } else if ((this->clearMask & outputMask(pin)) != 0) {
+      digitalWrite(pin, LOW);
+    }
+  }
+#else
+  if (this->setMask != 0) {
+    GPOS = this->setMask;
+  }
+  if (this->clearMask != 0) {
+    GPOC = this->clearMask;
+  }
+#endif
+}
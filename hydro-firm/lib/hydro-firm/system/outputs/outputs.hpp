@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SYSTEM_OUTPUTS_OUTPUTS_HPP
+#define SYSTEM_OUTPUTS_OUTPUTS_HPP
+
+#include <cstdint>
+
+namespace System {
+
+// Pin of an actuator which is not wired to an output
+const uint8_t NO_OUTPUT_PIN = UINT8_MAX;
+
+// Highest pin which can drive an actuator, the GPIO set and clear registers
+// of the ESP8266 cover GPIO 0 to 15
+const uint8_t MAX_OUTPUT_PIN = 15;
+
+/*
+ * Get the output mask of the pin, zero for a pin which cannot be driven
+ */
+constexpr auto outputMask(uint8_t pin) -> uint32_t { return pin <= MAX_OUTPUT_PIN ? UINT32_C(1) << pin : 0U; }
+
+/*
+ * Set the outputs in the mask up, driven low
+ */
+void setUpOutputs(uint32_t mask);
+
+/*
+ * Output changes of one control pass. The pump and valve changes of every
+ * actuator pair are collected first and written together by apply(), on the
+ * ESP8266 as a single write to the GPIO set and one to the clear register.
+ */
+class OutputWrite {
+
+private:
+  uint32_t setMask = 0;
+  uint32_t clearMask = 0;
+
+public:
+  /*
+   * Add the pump and valve outputs whose bit in changed is set, driven to
+   * their PUMP_ON_BIT and VALVE_CLOSED_BIT in actuators
+   */
+  void addActuators(uint8_t actuators, uint8_t changed, uint32_t pumpMask, uint32_t valveMask);
+
+  /*
+   * Add the outputs in the mask, driven low
+   */
+  void clear(uint32_t mask);
+
+  /*
+   * Drive the collected outputs
+   */
+  void apply() const;
+};
+
+} // namespace System
+
+#endif
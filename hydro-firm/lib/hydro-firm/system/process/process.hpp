@@ -33,41 +33,110 @@
 #define SYSTEM_PROCESS_PROCESS_HPP
 
 #include <system/controller/controller.hpp>
+#include <system/decision-table/decision-table.hpp>
 #include <system/state/state.hpp>
 
 namespace System {
 
-class Process {
+/*
+ * Decision logic of the system. The controller and the state are template
+ * parameters and are called by their static type, so an instantiation with
+ * final classes has no virtual calls and an instantiation with mocks keeps
+ * the test seams. Process instantiates it with the base classes.
+ */
+template <typename ControllerType, typename StateType> class BasicProcess {
 
 private:
-  State *state;
-  Controller *controller;
+  StateType *state;
+  ControllerType *controller;
+  // Decision index of the last evaluated pass
+  uint8_t evaluatedIndex = 0;
+  uint32_t evaluatedPasses = 0;
+  uint32_t skippedPasses = 0;
 
   /*
-   * Handle Cool down state of the system..
+   * Run the decision logic for the decision index. The action is looked up
+   * in DECISION_TABLE.
    */
-  void handleCoolDownState();
+  void evaluate(const uint8_t index) {
+    switch (DECISION_TABLE[index]) { // LCOV_EXCL_BR_LINE
+    case CLOSE_VALVE:
+      controller->closeValve();
+      break;
+    case DRAIN_WATER:
+      drainWater();
+      break;
+    case FILL_WATER:
+      fillWater();
+      break;
+    case NO_ACTION:
+    default:
+      break;
+    }
+  }
 
   /*
-   * Handle Active state of the system.
+   * Drain water from the Plant Container and set system to cool down state.
+   * Also resets the watering cycle state.
    */
-  void handleActiveState();
+  void drainWater() {
+    controller->turnOffPump();
+    controller->openValve();
+    state->resetWateringCycleState();
+    state->setCoolDownState();
+  }
 
   /*
-   * Handle Force watering cycle state of the system.
+   * Fill water to the Plant Container and set system to watering cycle state.
    */
-  void forceWateringCycle();
+  void fillWater() {
+    controller->closeValve();
 
+    controller->turnOnPump();
+
+    state->setWateringCycleState();
+  }
+
+public:
   /*
-   * Drain water from the Plant Container and set system to cool down state.
-   * Also resets the watering cycle state.
+   * Constructor
    */
-  void drainWater();
+  explicit BasicProcess(ControllerType &controller, StateType &state) : state(&state), controller(&controller) {}
 
   /*
-   * Fill water to the Plant Container and set system to watering cycle state.
+   * Run the system processes. The decision index holds everything the
+   * decision depends on, the threshold bits of the readings and the state
+   * word, so the decision logic only runs, and only touches the actuators,
+   * when the index changed since the last evaluated pass. Readings which are
+   * published again without crossing a threshold skip the pass. The actuator
+   * commands of a pass are applied together at its end.
+   */
+  void run() {
+    const uint8_t index = state->getDecisionIndex();
+    if (this->evaluatedPasses > 0 && index == this->evaluatedIndex) {
+      ++this->skippedPasses;
+      return;
+    }
+    // The index is taken before the decision logic runs, so a pass which
+    // changes the state word is followed by one more evaluated pass
+    this->evaluatedIndex = index;
+    ++this->evaluatedPasses;
+    this->evaluate(index);
+    controller->applyCommands();
+  }
+
+  /*
+   * Get the number of passes which ran the decision logic
    */
-  void fillWater();
+  auto getEvaluatedPasses() const -> uint32_t { return this->evaluatedPasses; }
+
+  /*
+   * Get the number of passes skipped because no input changed
+   */
+  auto getSkippedPasses() const -> uint32_t { return this->skippedPasses; }
+};
+
+class Process : public BasicProcess<Controller, State> {
 
 public:
   /*
@@ -76,7 +145,7 @@ public:
   explicit Process(System::Controller &controller, System::State &state);
 
   /*
-   * Run the system processes.
+   * Run the system processes, see BasicProcess::run()
    */
   virtual auto run() -> void;
 };
@@ -36,7 +36,9 @@
 /*
  * Constructor
  */
-System::State::State(Sensors::ReadSensors &readSensors) : readSensors{&readSensors} {}
+System::State::State(Sensors::ReadSensors &readSensors)
+    : readSensors{&readSensors}, waterLevelSensorId(readSensors.getSensorId(Sensors::WATER_LEVEL_SENSOR)),
+      moistureLevelSensorId(readSensors.getSensorId(Sensors::MOISTURE_LEVEL_SENSOR)) {}
 
 /*
  * Checks if the current water level is greater than or equal to maximum
@@ -44,7 +46,7 @@ System::State::State(Sensors::ReadSensors &readSensors) : readSensors{&readSenso
  */
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 auto System::State::isWaterLevelMax() -> bool {
-  const auto waterLevel = this->readSensors->getSensorReading(Sensors::WATER_LEVEL_SENSOR);
+  const auto waterLevel = this->readSensors->getSensorReadingById(this->waterLevelSensorId);
   return (waterLevel >= WATER_LEVEL_MAX_ALLOWED);
 }
 
@@ -54,7 +56,7 @@ auto System::State::isWaterLevelMax() -> bool {
  */
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 auto System::State::isWaterLevelMin() -> bool {
-  const auto waterLevel = this->readSensors->getSensorReading(Sensors::WATER_LEVEL_SENSOR);
+  const auto waterLevel = this->readSensors->getSensorReadingById(this->waterLevelSensorId);
   return waterLevel <= WATER_LEVEL_MIN_ALLOWED;
 }
 
@@ -64,7 +66,7 @@ auto System::State::isWaterLevelMin() -> bool {
  */
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 auto System::State::isMoistureLevelMin() const -> bool {
-  const auto moistureLevel = this->readSensors->getSensorReading(Sensors::MOISTURE_LEVEL_SENSOR);
+  const auto moistureLevel = this->readSensors->getSensorReadingById(this->moistureLevelSensorId);
   return moistureLevel <= MOISTURE_LEVEL_MIN_ALLOWED;
 }
 
@@ -72,81 +74,126 @@ auto System::State::isMoistureLevelMin() const -> bool {
  * Set system state to Cool Down State. In this state pump should be off and
  * valve should be closed.
  */
-void System::State::setCoolDownState() { this->coolDownState = true; }
+void System::State::setCoolDownState() { this->updateMode(COOL_DOWN_MODE); }
 
 /*
  * Reset system state from Cool Down State. In this state watering cycle can be
  * started. Here system transition into Active state.
  */
-void System::State::resetCoolDownState() {
-  this->coolDownState = false;
-  setActiveState();
-}
+void System::State::resetCoolDownState() { setActiveState(); }
 
 /*
  * Checks if the system is in Cool down state. Cool Down state will be enabled
  * after completing watering cycle for a predefined period of time. During
  * this period a new watering cycle will not be started.
  */
-auto System::State::isCoolDownState() const -> bool { return this->coolDownState; }
+auto System::State::isCoolDownState() const -> bool { return this->getMode() == COOL_DOWN_MODE; }
 
 /*
  * Set system state to Active State. In this state watering cycle can be
  * started.
  */
-void System::State::setActiveState() { this->activeState = true; }
+void System::State::setActiveState() { this->updateMode(ACTIVE_MODE); }
 
 /*
  * Reset system state from Active State. In this state watering cycle can be
  * started. Here system transition into Cool Down state.
  */
-void System::State::resetActiveState() {
-  this->activeState = false;
-  setCoolDownState();
-}
+void System::State::resetActiveState() { setCoolDownState(); }
 
 /*
  * Checks if the system is in Active state. System moves to the active state
  * after completing the cool down period. In Active state system can start a
  * watering cycle provided all conditions are met.
  */
-auto System::State::isActiveState() const -> bool { return this->activeState; }
+auto System::State::isActiveState() const -> bool { return this->getMode() == ACTIVE_MODE; }
 
 /*
  * Set system state to Watering Cycling State. In this state pump will be on
  * and valve will be closed.
  */
-void System::State::setWateringCycleState() { this->wateringCycleState = true; }
+void System::State::setWateringCycleState() { this->updateBit(WATERING_CYCLE_BIT, true); }
 
 /*
  * Reset system state from Watering Cycling State. In this state pump will be
  * off and valve will be open.
  */
-void System::State::resetWateringCycleState() { this->wateringCycleState = false; }
+void System::State::resetWateringCycleState() { this->updateBit(WATERING_CYCLE_BIT, false); }
 
 /*
  * Checks if the system is in Watering Cycle State. In Watering Cycle State
  * system will start moving water to plant containers and hold the water in
  * plant containers for a predefined amount of time.
  */
-auto System::State::isWateringCycleState() const -> bool { return this->wateringCycleState; }
+auto System::State::isWateringCycleState() const -> bool { return hasBit(this->stateWord, WATERING_CYCLE_BIT); }
 
 /**
  * Set the pump on or off state
  */
-void System::State::setPumpOn(const bool state) { this->pumpOn = state; }
+void System::State::setPumpOn(const bool state) { this->updateBit(PUMP_ON_BIT, state); }
 
 /*
  * Checks if the pump is working.
  */
-auto System::State::isPumpOn() const -> bool { return this->pumpOn; }
+auto System::State::isPumpOn() const -> bool { return hasBit(this->stateWord, PUMP_ON_BIT); }
 
 /**
  * Set the valve on or off state
  */
-void System::State::setValveClosed(const bool state) { this->valveClosed = state; }
+void System::State::setValveClosed(const bool state) { this->updateBit(VALVE_CLOSED_BIT, state); }
 
 /*
  * Checks if the valve is closed.
  */
-auto System::State::isValveClosed() const -> bool { return this->valveClosed; }
+auto System::State::isValveClosed() const -> bool { return hasBit(this->stateWord, VALVE_CLOSED_BIT); }
+
+/*
+ * Set the pump and the valve state together
+ */
+void System::State::setActuators(const bool pumpOn, const bool valveClosed) {
+  const unsigned actuatorBits = PUMP_ON_BIT | VALVE_CLOSED_BIT;
+  const unsigned actuators = (pumpOn ? PUMP_ON_BIT : 0U) | (valveClosed ? VALVE_CLOSED_BIT : 0U);
+  this->updateStateWord(static_cast<uint8_t>((static_cast<unsigned>(this->stateWord) & ~actuatorBits) | actuators));
+}
+
+/*
+ * Replace the state word
+ */
+void System::State::updateStateWord(const uint8_t word) { this->stateWord = word; }
+
+/*
+ * Set or clear a bit of the state word
+ */
+void System::State::updateBit(const uint8_t bit, const bool value) {
+  const unsigned cleared = static_cast<unsigned>(this->stateWord) & ~static_cast<unsigned>(bit);
+  this->updateStateWord(static_cast<uint8_t>(value ? cleared | bit : cleared));
+}
+
+/*
+ * Switch the state word to the mode
+ */
+void System::State::updateMode(const SYSTEM_MODE mode) {
+  const unsigned cleared = static_cast<unsigned>(this->stateWord) & ~static_cast<unsigned>(MODE_MASK);
+  this->updateStateWord(static_cast<uint8_t>(cleared | decisionIndex(mode, 0)));
+}
+
+/*
+ * Get the current mode
+ */
+auto System::State::getMode() const -> SYSTEM_MODE {
+  return static_cast<SYSTEM_MODE>((static_cast<unsigned>(this->stateWord) & MODE_MASK) >> MODE_SHIFT);
+}
+
+/*
+ * Get the packed state word
+ */
+auto System::State::getStateWord() const -> uint8_t { return this->stateWord; }
+
+/*
+ * Get the index into DECISION_TABLE for the current state and readings
+ */
+auto System::State::getDecisionIndex() -> uint8_t {
+  const auto waterLevel = this->readSensors->getSensorReadingById(this->waterLevelSensorId);
+  const auto moistureLevel = this->readSensors->getSensorReadingById(this->moistureLevelSensorId);
+  return decisionIndexFor(this->stateWord, waterLevel, moistureLevel);
+}
@@ -33,6 +33,7 @@
 #define SYSTEM_STATE_STATE_HPP
 
 #include <sensors/read-sensors/read-sensors.hpp>
+#include <system/decision-table/decision-table.hpp>
 
 namespace System {
 
@@ -46,18 +47,47 @@ const int16_t WATER_LEVEL_MIN_ALLOWED = 0;
 // Minimum allowed moisture level
 const int16_t MOISTURE_LEVEL_MIN_ALLOWED = 10;
 
+/*
+ * Get the index into DECISION_TABLE for the state word and the readings: the
+ * mode and watering cycle bits of the word combined with the threshold bits
+ */
+constexpr auto decisionIndexFor(uint8_t stateWord, int waterLevel, int moistureLevel) -> uint8_t {
+  return static_cast<uint8_t>((static_cast<unsigned>(stateWord) & DECISION_STATE_MASK) |
+                              (waterLevel >= WATER_LEVEL_MAX_ALLOWED ? WATER_LEVEL_MAX_BIT : 0U) |
+                              (waterLevel <= WATER_LEVEL_MIN_ALLOWED ? WATER_LEVEL_MIN_BIT : 0U) |
+                              (moistureLevel <= MOISTURE_LEVEL_MIN_ALLOWED ? MOISTURE_LEVEL_MIN_BIT : 0U));
+}
+
 class State {
 private:
-  bool valveClosed = false;
-  bool pumpOn = false;
-  bool wateringCycleState = false;
-  bool activeState = false;
-  bool coolDownState = false;
+  // Mode, watering cycle, pump and valve packed as laid out in
+  // decision-table.hpp, so that only valid combinations can be represented
+  uint8_t stateWord = decisionIndex(FORCED_WATERING_MODE, 0);
   Sensors::ReadSensors *readSensors;
+  // Identifiers of the sensors the thresholds are checked against, resolved
+  // once on construction
+  const Sensors::SENSOR_ID waterLevelSensorId;
+  const Sensors::SENSOR_ID moistureLevelSensorId;
+
+  /*
+   * Replace the state word
+   */
+  void updateStateWord(uint8_t word);
+
+  /*
+   * Set or clear a bit of the state word
+   */
+  void updateBit(uint8_t bit, bool value);
+
+  /*
+   * Switch the state word to the mode
+   */
+  void updateMode(SYSTEM_MODE mode);
 
 public:
   /*
-   * Constructor
+   * Constructor. The sensors have to be registered with readSensors before the
+   * state is created.
    */
   explicit State(Sensors::ReadSensors &readSensors);
 
@@ -120,6 +150,11 @@ public:
    */
   virtual auto isValveClosed() const -> bool;
 
+  /*
+   * Set the pump and the valve state together
+   */
+  virtual void setActuators(bool pumpOn, bool valveClosed);
+
   /*
    * Set system state to Watering Cycling State. In this state pump will be on
    * and valve will be closed.
@@ -155,6 +190,23 @@ public:
    * started. Here system transition into Cool Down state.
    */
   virtual void resetActiveState();
+
+  /*
+   * Get the current mode
+   */
+  auto getMode() const -> SYSTEM_MODE;
+
+  /*
+   * Get the packed state word
+   */
+  auto getStateWord() const -> uint8_t;
+
+  /*
+   * Get the index into DECISION_TABLE for the current state and readings:
+   * the mode and watering cycle bits of the state word combined with the
+   * threshold bits.
+   */
+  virtual auto getDecisionIndex() -> uint8_t;
 };
 } // namespace System
 
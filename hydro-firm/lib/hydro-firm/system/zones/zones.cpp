@@ -0,0 +1,134 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <system/state/state.hpp>
+#include <system/zones/zones.hpp>
+
+/*
+ * Constructor
+ */
+System::Zones::Zones(const Sensors::ReadSensors &readSensors) : readSensors(&readSensors) {}
+
+/*
+ * Add a zone starting with a forced watering cycle and set its outputs up
+ */
+auto System::Zones::addZone(const ZoneBinding &binding) -> ZONE_ID {
+  if (this->zoneCount >= MAX_ZONES) {
+    return INVALID_ZONE_ID;
+  }
+  const ZONE_ID zone = this->zoneCount;
+  this->waterLevelSensorIds[zone] = binding.waterLevelSensorId;
+  this->moistureLevelSensorIds[zone] = binding.moistureLevelSensorId;
+  this->stateWords[zone] = decisionIndex(FORCED_WATERING_MODE, 0);
+  // No decision index reaches the table size, so the first pass evaluates
+  // the zone
+  this->evaluatedIndexes[zone] = DECISION_TABLE_SIZE;
+  this->pumpMasks[zone] = outputMask(binding.pumpPin);
+  this->valveMasks[zone] = outputMask(binding.valvePin);
+  ++this->zoneCount;
+
+  setUpOutputs(this->pumpMasks[zone] | this->valveMasks[zone]);
+  return zone;
+}
+
+/*
+ * Run the control logic of all zones
+ */
+void System::Zones::run() {
+  OutputWrite outputs;
+  if (!this->evaluate(outputs)) {
+    ++this->skippedPasses;
+    return;
+  }
+  ++this->evaluatedPasses;
+  outputs.apply();
+}
+
+/*
+ * Run the decision logic of every zone whose decision index changed. As in
+ * System::Process an evaluation which changes the state word changes the
+ * index, so it is followed by one more.
+ */
+auto System::Zones::evaluate(OutputWrite &outputs) -> bool {
+  const Sensors::ReadingSnapshot &snapshot = this->readSensors->getAllSensorReading();
+  bool isEvaluated = false;
+  for (ZONE_ID zone = 0; zone < this->zoneCount; ++zone) {
+    const uint8_t word = this->stateWords[zone];
+    const uint8_t index = decisionIndexFor(word, snapshot.getReading(this->waterLevelSensorIds[zone]),
+                                           snapshot.getReading(this->moistureLevelSensorIds[zone]));
+    if (index == this->evaluatedIndexes[zone]) {
+      continue;
+    }
+    this->evaluatedIndexes[zone] = index;
+    isEvaluated = true;
+    const uint8_t next = applyAction(word, DECISION_TABLE[index]);
+    this->stateWords[zone] = next;
+    outputs.addActuators(next, static_cast<uint8_t>(word ^ next), this->pumpMasks[zone], this->valveMasks[zone]);
+  }
+  return isEvaluated;
+}
+
+/*
+ * Leave the cool down mode of the zone
+ */
+void System::Zones::resetCoolDown(const ZONE_ID zone) {
+  const uint8_t word = this->stateWords.at(zone);
+  if (this->getMode(zone) == COOL_DOWN_MODE) {
+    const unsigned cleared = static_cast<unsigned>(word) & ~static_cast<unsigned>(MODE_MASK);
+    this->stateWords[zone] = static_cast<uint8_t>(cleared | decisionIndex(ACTIVE_MODE, 0));
+  }
+}
+
+/*
+ * Get the packed state word of the zone
+ */
+auto System::Zones::getStateWord(const ZONE_ID zone) const -> uint8_t { return this->stateWords.at(zone); }
+
+/*
+ * Get the mode of the zone
+ */
+auto System::Zones::getMode(const ZONE_ID zone) const -> SYSTEM_MODE {
+  return static_cast<SYSTEM_MODE>((static_cast<unsigned>(this->stateWords.at(zone)) & MODE_MASK) >> MODE_SHIFT);
+}
+
+/*
+ * Get the number of zones
+ */
+auto System::Zones::getZoneCount() const -> uint8_t { return this->zoneCount; }
+
+/*
+ * Get the number of passes which ran the decision logic
+ */
+auto System::Zones::getEvaluatedPasses() const -> uint32_t { return this->evaluatedPasses; }
+
+/*
+ * Get the number of passes skipped because no decision index changed
+ */
+auto System::Zones::getSkippedPasses() const -> uint32_t { return this->skippedPasses; }
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef SYSTEM_ZONES_ZONES_HPP
+#define SYSTEM_ZONES_ZONES_HPP
+
+#include <array>
+#include <cstdint>
+#include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/sensor.hpp>
+#include <system/decision-table/decision-table.hpp>
+#include <system/outputs/outputs.hpp>
+
+namespace System {
+
+// Compact identifier of a zone, assigned in the order the zones are added
+using ZONE_ID = uint8_t;
+
+// Identifier of a zone which could not be added
+const ZONE_ID INVALID_ZONE_ID = UINT8_MAX;
+
+// Maximum number of zones on one node, one bit each in the changed zone mask
+const uint8_t MAX_ZONES = 32;
+
+/*
+ * Sensors and actuators of one plant container
+ */
+struct ZoneBinding {
+  Sensors::SENSOR_ID waterLevelSensorId;
+  Sensors::SENSOR_ID moistureLevelSensorId;
+  // Output driven high while the pump runs, NO_OUTPUT_PIN when not wired
+  uint8_t pumpPin;
+  // Output driven high while the valve is closed, NO_OUTPUT_PIN when not wired
+  uint8_t valvePin;
+};
+
+/*
+ * Control logic of several plant containers on one node. Every zone has its
+ * own state word and runs the same state machine as System::Process, all
+ * zones in one pass over arrays of sensor identifiers, state words and output
+ * masks. A zone is evaluated only when its decision index changed, and the
+ * outputs changed by a pass are written together at its end.
+ */
+class Zones {
+
+private:
+  const Sensors::ReadSensors *readSensors;
+  std::array<Sensors::SENSOR_ID, MAX_ZONES> waterLevelSensorIds = {};
+  std::array<Sensors::SENSOR_ID, MAX_ZONES> moistureLevelSensorIds = {};
+  std::array<uint8_t, MAX_ZONES> stateWords = {};
+  // Decision index each zone was last evaluated at
+  std::array<uint8_t, MAX_ZONES> evaluatedIndexes = {};
+  std::array<uint32_t, MAX_ZONES> pumpMasks = {};
+  std::array<uint32_t, MAX_ZONES> valveMasks = {};
+  uint8_t zoneCount = 0;
+  uint32_t evaluatedPasses = 0;
+  uint32_t skippedPasses = 0;
+
+  /*
+   * Run the decision logic of every zone whose decision index changed and
+   * collect the changed outputs. Returns false if no zone was evaluated.
+   */
+  auto evaluate(OutputWrite &outputs) -> bool;
+
+public:
+  /*
+   * Constructor. The sensors of the zones have to be registered with
+   * readSensors.
+   */
+  explicit Zones(const Sensors::ReadSensors &readSensors);
+
+  /*
+   * Add a zone starting with a forced watering cycle and set its outputs up.
+   * Returns INVALID_ZONE_ID if MAX_ZONES zones were added already.
+   */
+  auto addZone(const ZoneBinding &binding) -> ZONE_ID;
+
+  /*
+   * Run the control logic of all zones. Does nothing if the decision index
+   * of no zone changed since it was last evaluated.
+   */
+  void run();
+
+  /*
+   * Leave the cool down mode of the zone
+   */
+  void resetCoolDown(ZONE_ID zone);
+
+  /*
+   * Get the packed state word of the zone
+   */
+  auto getStateWord(ZONE_ID zone) const -> uint8_t;
+
+  /*
+   * Get the mode of the zone
+   */
+  auto getMode(ZONE_ID zone) const -> SYSTEM_MODE;
+
+  /*
+   * Get the number of zones
+   */
+  auto getZoneCount() const -> uint8_t;
+
+  /*
+   * Get the number of passes which ran the decision logic
+   */
+  auto getEvaluatedPasses() const -> uint32_t;
+
+  /*
+   * Get the number of passes skipped because no decision index changed
+   */
+  auto getSkippedPasses() const -> uint32_t;
+};
+
+} // namespace System
+
+#endif
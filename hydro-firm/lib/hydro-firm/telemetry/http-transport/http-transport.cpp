@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef NATIVE
+
+#include <telemetry/http-transport/http-transport.hpp>
+
+namespace {
+
+const int HTTP_SUCCESS_MIN = 200;
+const int HTTP_SUCCESS_MAX = 299;
+
+} // namespace
+
+/*
+ * Constructor
+ */
+Telemetry::HttpTransport::HttpTransport(const char *url) : url(url) {}
+
+/*
+ * Join the given WiFi network
+ */
+void Telemetry::HttpTransport::begin(const char *ssid, const char *password) {
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(true);
+  WiFi.begin(ssid, password);
+}
+
+/*
+ * Checks if WiFi is connected
+ */
+auto Telemetry::HttpTransport::isReady() -> bool { return WiFi.status() == WL_CONNECTED; }
+
+/*
+ * Post the batch, waiting at most HTTP_TIMEOUT for the server
+ */
+auto Telemetry::HttpTransport::send(const uint8_t *batch, const size_t length) -> bool {
+  if (!this->http.begin(this->client, this->url)) {
+    return false;
+  }
+  this->http.setTimeout(HTTP_TIMEOUT);
+  this->http.addHeader("Content-Type", "application/octet-stream");
+  const int status = this->http.POST(batch, length);
+  this->http.end();
+  return status >= HTTP_SUCCESS_MIN && status <= HTTP_SUCCESS_MAX;
+}
+
+#endif
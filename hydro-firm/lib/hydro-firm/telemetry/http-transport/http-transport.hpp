@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TELEMETRY_HTTP_TRANSPORT_HTTP_TRANSPORT_HPP
+#define TELEMETRY_HTTP_TRANSPORT_HTTP_TRANSPORT_HPP
+
+#ifndef NATIVE
+
+#include <ESP8266HTTPClient.h>
+#include <ESP8266WiFi.h>
+#include <telemetry/transport/transport.hpp>
+
+namespace Telemetry {
+
+// Time a request may block the loop waiting for the server, in milliseconds
+const uint16_t HTTP_TIMEOUT = 1000;
+
+/*
+ * Sends each batch as the body of one HTTP POST request over WiFi.
+ */
+class HttpTransport : public Transport {
+
+private:
+  const char *const url;
+  WiFiClient client;
+  HTTPClient http;
+
+public:
+  /*
+   * Constructor for a transport posting to the given URL
+   */
+  explicit HttpTransport(const char *url);
+
+  /*
+   * Join the given WiFi network. The connection is made and kept up in the
+   * background, the transport is ready once it is connected.
+   */
+  void begin(const char *ssid, const char *password);
+
+  /*
+   * Checks if WiFi is connected
+   */
+  auto isReady() -> bool override;
+
+  /*
+   * Post the batch. Returns false unless the server answers with a 2xx status.
+   */
+  auto send(const uint8_t *batch, size_t length) -> bool override;
+};
+
+} // namespace Telemetry
+
+#endif
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifdef NATIVE
+
+#include <telemetry/loopback/loopback.hpp>
+#include <utility>
+
+/*
+ * Constructor
+ */
+Telemetry::LoopbackTransport::LoopbackTransport(const size_t queueLength) : queueLength(queueLength) {}
+
+/*
+ * Checks if the link is connected and the queue has room for a batch
+ */
+auto Telemetry::LoopbackTransport::isReady() -> bool {
+  return this->connected && this->queue.size() < this->queueLength;
+}
+
+/*
+ * Queue a batch
+ */
+auto Telemetry::LoopbackTransport::send(const uint8_t *batch, const size_t length) -> bool {
+  if (!this->isReady()) {
+    ++this->rejectedBatches;
+    return false;
+  }
+  this->queue.emplace_back(batch, batch + length); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  ++this->receivedBatches;
+  this->receivedBytes += length;
+  return true;
+}
+
+/*
+ * Connect or disconnect the link
+ */
+void Telemetry::LoopbackTransport::setConnected(const bool isConnected) { this->connected = isConnected; }
+
+/*
+ * Take the oldest queued batch
+ */
+auto Telemetry::LoopbackTransport::receive(std::vector<uint8_t> &batch) -> bool {
+  if (this->queue.empty()) {
+    return false;
+  }
+  batch = std::move(this->queue.front());
+  this->queue.pop_front();
+  return true;
+}
+
+/*
+ * Get the number of batches waiting in the queue
+ */
+auto Telemetry::LoopbackTransport::getQueuedBatches() const -> size_t { return this->queue.size(); }
+
+/*
+ * Get the number of batches accepted
+ */
+auto Telemetry::LoopbackTransport::getReceivedBatches() const -> uint32_t { return this->receivedBatches; }
+
+/*
+ * Get the number of bytes accepted
+ */
+auto Telemetry::LoopbackTransport::getReceivedBytes() const -> uint64_t { return this->receivedBytes; }
+
+/*
+ * Get the number of batches refused because the server was not ready
+ */
+auto Telemetry::LoopbackTransport::getRejectedBatches() const -> uint32_t { return this->rejectedBatches; }
+
+#endif
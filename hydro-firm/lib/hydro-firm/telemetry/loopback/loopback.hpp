@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TELEMETRY_LOOPBACK_LOOPBACK_HPP
+#define TELEMETRY_LOOPBACK_LOOPBACK_HPP
+
+#ifdef NATIVE
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <telemetry/transport/transport.hpp>
+#include <vector>
+
+namespace Telemetry {
+
+// Default number of batches the loopback server queues before it applies
+// backpressure
+const size_t LOOPBACK_QUEUE_LENGTH = 8;
+
+/*
+ * In-process stand-in for the telemetry server on the native build. Queues
+ * the batches sent to it until they are received, and reports itself as not
+ * ready while the queue is full or the link is disconnected.
+ */
+class LoopbackTransport : public Transport {
+
+private:
+  std::deque<std::vector<uint8_t>> queue;
+  const size_t queueLength;
+  bool connected = true;
+  uint32_t receivedBatches = 0;
+  uint64_t receivedBytes = 0;
+  uint32_t rejectedBatches = 0;
+
+public:
+  /*
+   * Constructor for a server queueing up to queueLength batches
+   */
+  explicit LoopbackTransport(size_t queueLength = LOOPBACK_QUEUE_LENGTH);
+
+  /*
+   * Checks if the link is connected and the queue has room for a batch
+   */
+  auto isReady() -> bool override;
+
+  /*
+   * Queue a batch. Returns false if the server is not ready.
+   */
+  auto send(const uint8_t *batch, size_t length) -> bool override;
+
+  /*
+   * Connect or disconnect the link
+   */
+  void setConnected(bool isConnected);
+
+  /*
+   * Take the oldest queued batch. Returns false if the queue is empty.
+   */
+  auto receive(std::vector<uint8_t> &batch) -> bool;
+
+  /*
+   * Get the number of batches waiting in the queue
+   */
+  auto getQueuedBatches() const -> size_t;
+
+  /*
+   * Get the number of batches accepted
+   */
+  auto getReceivedBatches() const -> uint32_t;
+
+  /*
+   * Get the number of bytes accepted
+   */
+  auto getReceivedBytes() const -> uint64_t;
+
+  /*
+   * Get the number of batches refused because the server was not ready
+   */
+  auto getRejectedBatches() const -> uint32_t;
+};
+
+} // namespace Telemetry
+
+#endif
+
+#endif
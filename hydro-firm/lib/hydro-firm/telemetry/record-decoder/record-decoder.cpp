@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/bit-stream/bit-stream.hpp>
+#include <telemetry/record-decoder/record-decoder.hpp>
+
+namespace {
+
+const uint8_t VARINT_BITS = 7;
+const uint8_t VARINT_MASK = 0x7F;
+const uint8_t VARINT_CONTINUE = 0x80;
+const uint8_t VARINT_LAST_SHIFT = 28;
+const uint8_t BYTE_BITS = 8;
+
+/*
+ * Read a little endian value starting at the offset
+ */
+auto getLittleEndian(const uint8_t *input, const size_t offset, const size_t size) -> uint32_t {
+  uint32_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value |= static_cast<uint32_t>(input[offset + i]) << (BYTE_BITS * i); // NOLINT
+  }
+  return value;
+}
+
+} // namespace
+
+/*
+ * Handle a complete header
+ */
+auto Telemetry::RecordDecoder::startBatch() -> bool {
+  if (this->header[1] != RECORD_FORMAT_VERSION) {
+    return false;
+  }
+  const uint8_t *fields = this->header.data();
+  this->remainingRecords = static_cast<uint16_t>(getLittleEndian(fields, RECORD_COUNT_OFFSET, sizeof(uint16_t)));
+  this->remainingBytes = static_cast<uint16_t>(getLittleEndian(fields, RECORD_LENGTH_OFFSET, sizeof(uint16_t)));
+  this->record.timestamp = getLittleEndian(fields, RECORD_TIMESTAMP_OFFSET, sizeof(uint32_t));
+  this->previousValues.fill(0);
+  this->headerLength = 0;
+  // An empty batch is only valid without payload
+  if (this->remainingRecords == 0) {
+    if (this->remainingBytes != 0) {
+      return false;
+    }
+    ++this->decodedBatches;
+    return true;
+  }
+  this->phase = SENSOR;
+  return true;
+}
+
+/*
+ * Add a byte to the varint
+ */
+auto Telemetry::RecordDecoder::pushVarint(const uint8_t byte) -> bool {
+  this->varint |= static_cast<uint32_t>(byte & VARINT_MASK) << this->varintShift;
+  if ((byte & VARINT_CONTINUE) == 0) {
+    return true;
+  }
+  this->varintShift += VARINT_BITS;
+  return false;
+}
+
+/*
+ * Drop the current batch and look for the next header
+ */
+auto Telemetry::RecordDecoder::fail() -> DECODE_STATUS {
+  this->phase = HEADER;
+  this->headerLength = 0;
+  ++this->errors;
+  return DECODE_ERROR;
+}
+
+/*
+ * Consume bytes of the stream up to the end of the next record
+ */
+auto Telemetry::RecordDecoder::next(const uint8_t *bytes, const size_t length, Record &decoded, size_t &consumed)
+    -> DECODE_STATUS {
+  consumed = 0;
+  while (consumed < length) {
+    const uint8_t byte = bytes[consumed++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (this->phase == HEADER) {
+      if (this->headerLength == 0 && byte != RECORD_MAGIC) {
+        return this->fail();
+      }
+      this->header.at(this->headerLength++) = byte;
+      if (this->headerLength == RECORD_HEADER_SIZE && !this->startBatch()) {
+        return this->fail();
+      }
+      continue;
+    }
+
+    if (this->remainingBytes == 0) {
+      return this->fail();
+    }
+    --this->remainingBytes;
+    if (this->phase == SENSOR) {
+      this->record.sensorId = byte;
+      this->varint = 0;
+      this->varintShift = 0;
+      this->phase = TIMESTAMP;
+      continue;
+    }
+    if (this->varintShift == VARINT_LAST_SHIFT && byte > (UINT32_MAX >> VARINT_LAST_SHIFT)) {
+      return this->fail();
+    }
+    if (!this->pushVarint(byte)) {
+      continue;
+    }
+    if (this->phase == TIMESTAMP) {
+      this->record.timestamp += static_cast<uint32_t>(Data::zigZagDecode(this->varint));
+      this->varint = 0;
+      this->varintShift = 0;
+      this->phase = VALUE;
+      continue;
+    }
+
+    const bool isTracked = this->record.sensorId < Sensors::MAX_SENSORS;
+    const int32_t previousValue = isTracked ? this->previousValues.at(this->record.sensorId) : 0;
+    this->record.value = static_cast<int32_t>(static_cast<uint32_t>(previousValue) +
+                                              static_cast<uint32_t>(Data::zigZagDecode(this->varint)));
+    if (isTracked) {
+      this->previousValues.at(this->record.sensorId) = this->record.value;
+    }
+    this->phase = SENSOR;
+    if (--this->remainingRecords == 0) {
+      if (this->remainingBytes != 0) {
+        return this->fail();
+      }
+      this->phase = HEADER;
+      ++this->decodedBatches;
+    }
+    decoded = this->record;
+    return DECODE_RECORD;
+  }
+  return DECODE_NEED_MORE;
+}
+
+/*
+ * Get the number of batches decoded completely
+ */
+auto Telemetry::RecordDecoder::getDecodedBatches() const -> uint32_t { return this->decodedBatches; }
+
+/*
+ * Get the number of errors
+ */
+auto Telemetry::RecordDecoder::getErrors() const -> uint32_t { return this->errors; }
@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TELEMETRY_RECORD_DECODER_RECORD_DECODER_HPP
+#define TELEMETRY_RECORD_DECODER_RECORD_DECODER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <telemetry/record-format/record-format.hpp>
+
+namespace Telemetry {
+
+enum DECODE_STATUS { DECODE_NEED_MORE, DECODE_RECORD, DECODE_ERROR };
+
+/*
+ * Decodes a stream of batches in the record format as it arrives, in chunks
+ * of any size. Each call consumes bytes up to the end of the next record.
+ * After a malformed batch the decoder looks for the next header.
+ */
+class RecordDecoder {
+
+private:
+  enum PHASE { HEADER, SENSOR, TIMESTAMP, VALUE };
+
+  PHASE phase = HEADER;
+  std::array<uint8_t, RECORD_HEADER_SIZE> header = {};
+  size_t headerLength = 0;
+  uint32_t varint = 0;
+  uint8_t varintShift = 0;
+  uint16_t remainingRecords = 0;
+  uint16_t remainingBytes = 0;
+  Record record = {};
+  std::array<int32_t, Sensors::MAX_SENSORS> previousValues = {};
+  uint32_t decodedBatches = 0;
+  uint32_t errors = 0;
+
+  /*
+   * Handle a complete header. Returns false if the header is invalid.
+   */
+  auto startBatch() -> bool;
+
+  /*
+   * Add a byte to the varint. Returns true once the varint is complete.
+   */
+  auto pushVarint(uint8_t byte) -> bool;
+
+  /*
+   * Drop the current batch and look for the next header
+   */
+  auto fail() -> DECODE_STATUS;
+
+public:
+  /*
+   * Consume bytes of the stream, at most up to the end of the next record,
+   * and report the number of bytes consumed. Returns DECODE_RECORD with the
+   * record filled in, DECODE_NEED_MORE once all bytes are consumed without
+   * completing a record, or DECODE_ERROR on malformed input.
+   */
+  auto next(const uint8_t *bytes, size_t length, Record &decoded, size_t &consumed) -> DECODE_STATUS;
+
+  /*
+   * Get the number of batches decoded completely
+   */
+  auto getDecodedBatches() const -> uint32_t;
+
+  /*
+   * Get the number of errors, each dropping a batch or a byte outside of one
+   */
+  auto getErrors() const -> uint32_t;
+};
+
+} // namespace Telemetry
+
+#endif
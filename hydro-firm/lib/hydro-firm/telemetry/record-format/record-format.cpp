@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <algorithm>
+#include <data/bit-stream/bit-stream.hpp>
+#include <telemetry/record-format/record-format.hpp>
+
+namespace {
+
+const uint8_t VARINT_BITS = 7;
+const uint8_t VARINT_MASK = 0x7F;
+const uint8_t VARINT_CONTINUE = 0x80;
+const uint8_t BYTE_BITS = 8;
+const uint8_t BYTE_MASK = 0xFF;
+
+/*
+ * Store a value in little endian order
+ */
+void putLittleEndian(uint8_t *output, const uint32_t value, const size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    output[i] = static_cast<uint8_t>((value >> (BYTE_BITS * i)) & BYTE_MASK); // NOLINT
+  }
+}
+
+} // namespace
+
+/*
+ * Write the value as a varint
+ */
+auto Telemetry::writeVarint(uint32_t value, uint8_t *output) -> size_t {
+  size_t size = 0;
+  while (value > VARINT_MASK) {
+    output[size++] = static_cast<uint8_t>((value & VARINT_MASK) | VARINT_CONTINUE); // NOLINT
+    value >>= VARINT_BITS;
+  }
+  output[size++] = static_cast<uint8_t>(value); // NOLINT
+  return size;
+}
+
+/*
+ * Constructor
+ */
+Telemetry::RecordEncoder::RecordEncoder(uint8_t *buffer, const size_t capacity)
+    : buffer(buffer), capacity(std::min(capacity, MAX_RECORD_BATCH_SIZE)) {}
+
+/*
+ * Add a reading to the batch
+ */
+auto Telemetry::RecordEncoder::append(const Sensors::SENSOR_ID sensorId, const uint32_t timestamp,
+                                      const int32_t value) -> bool {
+  if (this->recordCount == 0) {
+    this->baseTimestamp = timestamp;
+    this->previousTimestamp = timestamp;
+    this->previousValues.fill(0);
+  }
+
+  const bool isTracked = sensorId < Sensors::MAX_SENSORS;
+  const int32_t previousValue = isTracked ? this->previousValues.at(sensorId) : 0;
+  std::array<uint8_t, MAX_RECORD_SIZE> record = {};
+  size_t size = 0;
+  record[size++] = sensorId;
+  // Wrapping differences keep every pair of values representable
+  size += writeVarint(Data::zigZagEncode(static_cast<int32_t>(timestamp - this->previousTimestamp)), &record.at(size));
+  size += writeVarint(Data::zigZagEncode(static_cast<int32_t>(static_cast<uint32_t>(value) -
+                                                              static_cast<uint32_t>(previousValue))),
+                      &record.at(size));
+  if (this->length + size > this->capacity) {
+    return false;
+  }
+
+  std::copy(record.begin(), record.begin() + size, this->buffer + this->length); // NOLINT
+  this->length += size;
+  ++this->recordCount;
+  this->previousTimestamp = timestamp;
+  if (isTracked) {
+    this->previousValues.at(sensorId) = value;
+  }
+  return true;
+}
+
+/*
+ * Write the header
+ */
+auto Telemetry::RecordEncoder::finish() -> size_t {
+  const auto payloadLength = static_cast<uint32_t>(this->length - RECORD_HEADER_SIZE);
+  this->buffer[0] = RECORD_MAGIC;                                                                 // NOLINT
+  this->buffer[1] = RECORD_FORMAT_VERSION;                                                        // NOLINT
+  putLittleEndian(this->buffer + RECORD_COUNT_OFFSET, this->recordCount, sizeof(uint16_t));       // NOLINT
+  putLittleEndian(this->buffer + RECORD_LENGTH_OFFSET, payloadLength, sizeof(uint16_t));          // NOLINT
+  putLittleEndian(this->buffer + RECORD_TIMESTAMP_OFFSET, this->baseTimestamp, sizeof(uint32_t)); // NOLINT
+  return this->length;
+}
+
+/*
+ * Empty the batch
+ */
+void Telemetry::RecordEncoder::clear() {
+  this->length = RECORD_HEADER_SIZE;
+  this->recordCount = 0;
+}
+
+/*
+ * Get the number of readings in the batch
+ */
+auto Telemetry::RecordEncoder::getRecordCount() const -> uint16_t { return this->recordCount; }
+
+/*
+ * Get the length of the batch including its header
+ */
+auto Telemetry::RecordEncoder::getLength() const -> size_t { return this->length; }
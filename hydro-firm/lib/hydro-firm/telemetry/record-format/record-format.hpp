@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TELEMETRY_RECORD_FORMAT_RECORD_FORMAT_HPP
+#define TELEMETRY_RECORD_FORMAT_RECORD_FORMAT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <sensors/sensor.hpp>
+
+namespace Telemetry {
+
+/*
+ * Binary batch format, version 1, all multi-byte header fields little endian:
+ *
+ *   header  magic (1) | version (1) | record count (2) | payload length (2) |
+ *           base timestamp (4)
+ *   record  sensor identifier (1) | timestamp delta (varint, zig-zag) |
+ *           value delta (varint, zig-zag)
+ *
+ * The timestamp delta is taken from the previous record of the batch, the
+ * first record from the base timestamp. The value delta is taken from the
+ * previous record of the same sensor in the batch, the first one from zero.
+ * Sensors from MAX_SENSORS on are not tracked and always send the value
+ * itself. Every batch thus decodes on its own.
+ */
+const uint8_t RECORD_MAGIC = 0x5A;
+const uint8_t RECORD_FORMAT_VERSION = 1;
+const size_t RECORD_HEADER_SIZE = 10;
+const size_t RECORD_COUNT_OFFSET = 2;
+const size_t RECORD_LENGTH_OFFSET = 4;
+const size_t RECORD_TIMESTAMP_OFFSET = 6;
+
+// Largest batch whose payload length fits its header field
+const size_t MAX_RECORD_BATCH_SIZE = RECORD_HEADER_SIZE + UINT16_MAX;
+
+// Longest varint of a 32 bit value
+const size_t MAX_VARINT_SIZE = 5;
+
+// Longest encoded record
+const size_t MAX_RECORD_SIZE = 1 + 2 * MAX_VARINT_SIZE;
+
+/*
+ * Reading carried by a record
+ */
+struct Record {
+  Sensors::SENSOR_ID sensorId;
+  uint32_t timestamp;
+  int32_t value;
+};
+
+/*
+ * Write the value as a varint of 7 bits per byte, lowest group first, into
+ * the output which has room for MAX_VARINT_SIZE bytes. Returns the number of
+ * bytes written.
+ */
+auto writeVarint(uint32_t value, uint8_t *output) -> size_t;
+
+/*
+ * Packs readings into a batch in the record format inside a caller provided
+ * buffer. The first reading appended to an empty batch sets its base
+ * timestamp.
+ */
+class RecordEncoder {
+
+private:
+  uint8_t *const buffer;
+  const size_t capacity;
+  size_t length = RECORD_HEADER_SIZE;
+  uint16_t recordCount = 0;
+  uint32_t baseTimestamp = 0;
+  uint32_t previousTimestamp = 0;
+  std::array<int32_t, Sensors::MAX_SENSORS> previousValues = {};
+
+public:
+  /*
+   * Constructor for an encoder filling a buffer of the given capacity, which
+   * must hold at least the header and one record. Capacity beyond
+   * MAX_RECORD_BATCH_SIZE is left unused.
+   */
+  explicit RecordEncoder(uint8_t *buffer, size_t capacity);
+
+  /*
+   * Add a reading to the batch. Returns false, leaving the batch unchanged,
+   * if the reading does not fit.
+   */
+  auto append(Sensors::SENSOR_ID sensorId, uint32_t timestamp, int32_t value) -> bool;
+
+  /*
+   * Write the header, returning the length of the batch in the buffer. The
+   * batch stays open for more readings.
+   */
+  auto finish() -> size_t;
+
+  /*
+   * Empty the batch
+   */
+  void clear();
+
+  /*
+   * Get the number of readings in the batch
+   */
+  auto getRecordCount() const -> uint16_t;
+
+  /*
+   * Get the length of the batch including its header
+   */
+  auto getLength() const -> size_t;
+};
+
+} // namespace Telemetry
+
+#endif
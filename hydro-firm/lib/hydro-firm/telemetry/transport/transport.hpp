@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TELEMETRY_TRANSPORT_TRANSPORT_HPP
+#define TELEMETRY_TRANSPORT_TRANSPORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Telemetry {
+
+/*
+ * Network link the telemetry batches are sent over. A batch is sent with a
+ * single call.
+ */
+class Transport {
+
+public:
+  virtual ~Transport() = default;
+
+  /*
+   * Checks if the transport can take a batch now. Returns false while the
+   * link is down or the receiver is applying backpressure.
+   */
+  virtual auto isReady() -> bool = 0;
+
+  /*
+   * Send a batch. Returns false if the batch was not delivered.
+   */
+  virtual auto send(const uint8_t *batch, size_t length) -> bool = 0;
+};
+
+} // namespace Telemetry
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <algorithm>
+#include <telemetry/uplink/uplink.hpp>
+
+/*
+ * Constructor
+ */
+Telemetry::Uplink::Uplink(Transport &transport)
+    : transport(&transport), encoder(this->batch.data(), this->batch.size()) {}
+
+/*
+ * Add a reading to the batch, sending the batch first if it is full or too old
+ */
+auto Telemetry::Uplink::record(const Sensors::SENSOR_ID sensorId, const uint32_t timestamp, const int sensorReading)
+    -> bool {
+  if (this->encoder.getRecordCount() > 0 && timestamp - this->batchStart >= TELEMETRY_BATCH_AGE) {
+    this->trySend(timestamp);
+  }
+  if (!this->encoder.append(sensorId, timestamp, sensorReading)) {
+    if (!this->trySend(timestamp)) {
+      ++this->droppedSamples;
+      return false;
+    }
+    this->encoder.append(sensorId, timestamp, sensorReading);
+  }
+  if (this->encoder.getRecordCount() == 1) {
+    this->batchStart = timestamp;
+  }
+  return true;
+}
+
+/*
+ * Send the batch if it holds any reading
+ */
+auto Telemetry::Uplink::flush() -> bool {
+  if (this->encoder.getRecordCount() == 0) {
+    return true;
+  }
+  const size_t length = this->encoder.finish();
+  if (!this->transport->isReady() || !this->transport->send(this->batch.data(), length)) {
+    return false;
+  }
+  ++this->sentBatches;
+  this->sentSamples += this->encoder.getRecordCount();
+  this->encoder.clear();
+  this->retryDelay = 0;
+  return true;
+}
+
+/*
+ * Send the batch unless the retry delay of a failed send is still running
+ */
+auto Telemetry::Uplink::trySend(const uint32_t now) -> bool {
+  if (this->retryDelay > 0 && now - this->failedAt < this->retryDelay) {
+    return false;
+  }
+  if (this->flush()) {
+    return true;
+  }
+  this->failedAt = now;
+  this->retryDelay =
+      this->retryDelay == 0 ? TELEMETRY_RETRY_DELAY_MIN : std::min(2 * this->retryDelay, TELEMETRY_RETRY_DELAY_MAX);
+  return false;
+}
+
+/*
+ * Get the number of readings waiting in the batch
+ */
+auto Telemetry::Uplink::getPendingSamples() const -> uint16_t { return this->encoder.getRecordCount(); }
+
+/*
+ * Get the number of batches sent
+ */
+auto Telemetry::Uplink::getSentBatches() const -> uint32_t { return this->sentBatches; }
+
+/*
+ * Get the number of readings sent
+ */
+auto Telemetry::Uplink::getSentSamples() const -> uint32_t { return this->sentSamples; }
+
+/*
+ * Get the number of readings dropped because the transport was not ready
+ */
+auto Telemetry::Uplink::getDroppedSamples() const -> uint32_t { return this->droppedSamples; }
+
+/*
+ * Get the delay before a failed batch is tried again
+ */
+auto Telemetry::Uplink::getRetryDelay() const -> uint32_t { return this->retryDelay; }
@@ -0,0 +1,134 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TELEMETRY_UPLINK_UPLINK_HPP
+#define TELEMETRY_UPLINK_UPLINK_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <data/sample-sink/sample-sink.hpp>
+#include <telemetry/record-format/record-format.hpp>
+#include <telemetry/transport/transport.hpp>
+
+namespace Telemetry {
+
+// Maximum size of a batch in bytes
+const size_t TELEMETRY_BATCH_SIZE = 512;
+
+// Maximum time a reading waits in a batch before the batch is sent, in
+// milliseconds
+const uint32_t TELEMETRY_BATCH_AGE = 30000;
+
+// Time before a batch which could not be sent is tried again, doubled on
+// every further failure up to the maximum, in milliseconds
+const uint32_t TELEMETRY_RETRY_DELAY_MIN = 1000;
+const uint32_t TELEMETRY_RETRY_DELAY_MAX = 300000;
+
+/*
+ * Collects readings into batches and sends each batch over the transport
+ * with a single write. A batch is sent once the next reading does not fit or
+ * its oldest reading reaches TELEMETRY_BATCH_AGE. While the transport is not
+ * ready the batch is kept and readings which do not fit are dropped, so the
+ * memory used stays at one batch. After a failed send the batch is not tried
+ * again before an exponentially growing retry delay has passed, so a dead
+ * link does not cost a blocking send on every reading.
+ *
+ * Batches are sent in the binary record format of RecordEncoder.
+ */
+class Uplink : public Data::SampleSink {
+
+private:
+  Transport *transport;
+  std::array<uint8_t, TELEMETRY_BATCH_SIZE> batch = {};
+  RecordEncoder encoder;
+  uint32_t batchStart = 0;
+  // Time of the last failed send and the delay before the next try, zero
+  // while sends succeed
+  uint32_t failedAt = 0;
+  uint32_t retryDelay = 0;
+  uint32_t sentBatches = 0;
+  uint32_t sentSamples = 0;
+  uint32_t droppedSamples = 0;
+
+  /*
+   * Send the batch unless the retry delay of a failed send is still running
+   * at the given time. A failure starts or doubles the retry delay.
+   */
+  auto trySend(uint32_t now) -> bool;
+
+public:
+  /*
+   * Constructor
+   */
+  explicit Uplink(Transport &transport);
+
+  /*
+   * Add a reading to the batch, sending the batch first if it is full or too
+   * old. Returns false if the reading was dropped.
+   */
+  auto record(Sensors::SENSOR_ID sensorId, uint32_t timestamp, int sensorReading) -> bool override;
+
+  /*
+   * Send the batch if it holds any reading, regardless of the retry delay.
+   * Returns false if the batch could not be sent, in which case it is kept.
+   */
+  auto flush() -> bool;
+
+  /*
+   * Get the number of readings waiting in the batch
+   */
+  auto getPendingSamples() const -> uint16_t;
+
+  /*
+   * Get the number of batches sent
+   */
+  auto getSentBatches() const -> uint32_t;
+
+  /*
+   * Get the number of readings sent
+   */
+  auto getSentSamples() const -> uint32_t;
+
+  /*
+   * Get the number of readings dropped because the transport was not ready
+   */
+  auto getDroppedSamples() const -> uint32_t;
+
+  /*
+   * Get the delay before a failed batch is tried again, zero while sends
+   * succeed
+   */
+  auto getRetryDelay() const -> uint32_t;
+};
+
+} // namespace Telemetry
+
+#endif
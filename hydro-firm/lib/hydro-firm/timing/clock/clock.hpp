@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TIMING_CLOCK_CLOCK_HPP
+#define TIMING_CLOCK_CLOCK_HPP
+
+#include <cstdint>
+
+namespace Timing {
+
+/*
+ * Source of time for every time dependent component. Readings wrap around
+ * after about 49 days like the Arduino millis() does.
+ */
+class Clock {
+
+public:
+  virtual ~Clock() = default;
+
+  /*
+   * Get the milliseconds passed since the clock started
+   */
+  virtual auto millis() const -> uint32_t = 0;
+
+  /*
+   * Wait for the given number of milliseconds
+   */
+  virtual void delay(uint32_t milliseconds) = 0;
+
+  /*
+   * Wait for the given number of microseconds
+   */
+  virtual void delayMicroseconds(uint32_t microseconds) = 0;
+};
+
+} // namespace Timing
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TIMING_CYCLE_COUNTER_CYCLE_COUNTER_HPP
+#define TIMING_CYCLE_COUNTER_CYCLE_COUNTER_HPP
+
+#include <cstdint>
+
+#ifdef NATIVE
+#include <chrono>
+#else
+#include <Arduino.h>
+#endif
+
+namespace Timing {
+
+#ifdef NATIVE
+// Unit of the cycle counter, nanoseconds of the host clock
+const char *const CYCLE_COUNTER_UNIT = "ns";
+#else
+// Unit of the cycle counter, CPU cycles
+const char *const CYCLE_COUNTER_UNIT = "cycles";
+#endif
+
+/*
+ * Read the free running cycle counter. Differences of two readings measure
+ * short intervals, wrapping around like millis() does.
+ */
+inline auto readCycleCounter() -> uint32_t {
+#ifdef NATIVE
+  const auto sinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(sinceEpoch).count());
+#else
+  return ESP.getCycleCount();
+#endif
+}
+
+} // namespace Timing
+
+#endif
@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <timing/hardware-clock/hardware-clock.hpp>
+
+#ifdef NATIVE
+#include <ArduinoFake.h>
+#else
+#include <Arduino.h>
+#endif
+
+/*
+ * Get the milliseconds passed since the board started
+ */
+auto Timing::HardwareClock::millis() const -> uint32_t { return ::millis(); }
+
+/*
+ * Busy wait for the given number of milliseconds
+ */
+void Timing::HardwareClock::delay(const uint32_t milliseconds) { ::delay(milliseconds); }
+
+/*
+ * Busy wait for the given number of microseconds
+ */
+void Timing::HardwareClock::delayMicroseconds(const uint32_t microseconds) { ::delayMicroseconds(microseconds); }
+
+/*
+ * Get the hardware clock used by default by every time dependent component
+ */
+auto Timing::getHardwareClock() -> HardwareClock & {
+  static HardwareClock clock; // LCOV_EXCL_BR_LINE
+  return clock;
+}
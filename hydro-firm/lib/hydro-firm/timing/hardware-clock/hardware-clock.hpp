@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TIMING_HARDWARE_CLOCK_HARDWARE_CLOCK_HPP
+#define TIMING_HARDWARE_CLOCK_HARDWARE_CLOCK_HPP
+
+#include <cstdint>
+#include <timing/clock/clock.hpp>
+
+namespace Timing {
+
+/*
+ * Clock of the Arduino core. On the native build the calls go to ArduinoFake.
+ */
+class HardwareClock final : public Clock {
+
+public:
+  /*
+   * Get the milliseconds passed since the board started
+   */
+  auto millis() const -> uint32_t override;
+
+  /*
+   * Busy wait for the given number of milliseconds
+   */
+  void delay(uint32_t milliseconds) override;
+
+  /*
+   * Busy wait for the given number of microseconds
+   */
+  void delayMicroseconds(uint32_t microseconds) override;
+};
+
+/*
+ * Get the hardware clock used by default by every time dependent component
+ */
+auto getHardwareClock() -> HardwareClock &;
+
+} // namespace Timing
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <timing/histogram/histogram.hpp>
+
+namespace {
+
+const uint8_t MEDIAN = 50;
+const uint8_t TAIL_PERCENTILE = 99;
+const uint32_t PERCENT = 100;
+
+} // namespace
+
+/*
+ * Get the bucket of the given value
+ */
+auto Timing::Histogram::getBucketIndex(const uint32_t value) -> uint8_t {
+  return value == 0 ? 0 : static_cast<uint8_t>(32 - __builtin_clz(value));
+}
+
+/*
+ * Get the largest value of the given bucket
+ */
+auto Timing::Histogram::getBucketLimit(const uint8_t bucket) -> uint32_t {
+  return bucket >= HISTOGRAM_BUCKETS - 1 ? UINT32_MAX : (UINT32_C(1) << bucket) - 1;
+}
+
+/*
+ * Record a duration
+ */
+void Timing::Histogram::record(const uint32_t value) {
+  ++this->buckets[getBucketIndex(value)];
+  ++this->count;
+  this->maximum = std::max(this->maximum, value);
+}
+
+/*
+ * Remove all recorded durations
+ */
+void Timing::Histogram::reset() {
+  this->buckets.fill(0);
+  this->count = 0;
+  this->maximum = 0;
+}
+
+/*
+ * Get the number of recorded durations
+ */
+auto Timing::Histogram::getCount() const -> uint32_t { return this->count; }
+
+/*
+ * Get the longest recorded duration
+ */
+auto Timing::Histogram::getMaximum() const -> uint32_t { return this->maximum; }
+
+/*
+ * Get the number of durations recorded in the given bucket
+ */
+auto Timing::Histogram::getBucket(const uint8_t bucket) const -> uint32_t { return this->buckets.at(bucket); }
+
+/*
+ * Get an upper bound of the given percentile
+ */
+auto Timing::Histogram::getPercentile(const uint8_t percent) const -> uint32_t {
+  // Rank of the percentile, rounded up so that p100 is the maximum
+  const uint64_t rank = (static_cast<uint64_t>(this->count) * percent + PERCENT - 1) / PERCENT;
+  uint64_t seen = 0;
+  for (uint8_t bucket = 0; bucket < HISTOGRAM_BUCKETS; ++bucket) {
+    seen += this->buckets[bucket];
+    if (seen >= rank && seen > 0) {
+      return std::min(getBucketLimit(bucket), this->maximum);
+    }
+  }
+  return 0;
+}
+
+/*
+ * Write a one line summary of the histogram
+ */
+auto Timing::Histogram::format(char *buffer, const size_t size) const -> int {
+  int length = std::snprintf(buffer, size, "count=%u p50=%u p99=%u max=%u", static_cast<unsigned>(this->count),
+                             static_cast<unsigned>(this->getPercentile(MEDIAN)),
+                             static_cast<unsigned>(this->getPercentile(TAIL_PERCENTILE)),
+                             static_cast<unsigned>(this->maximum));
+  for (uint8_t bucket = 0; bucket < HISTOGRAM_BUCKETS; ++bucket) {
+    if (this->buckets[bucket] == 0) {
+      continue;
+    }
+    // Keep writing at the end of what fitted, counting the full length
+    const size_t offset = std::min(static_cast<size_t>(length), size == 0 ? 0 : size - 1);
+    length += std::snprintf(buffer + offset, size - offset, " <=%u:%u", static_cast<unsigned>(getBucketLimit(bucket)),
+                            static_cast<unsigned>(this->buckets[bucket]));
+  }
+  return length;
+}
@@ -0,0 +1,106 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TIMING_HISTOGRAM_HISTOGRAM_HPP
+#define TIMING_HISTOGRAM_HISTOGRAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Timing {
+
+// Bucket 0 holds zero, bucket k the values from 2^(k-1) to 2^k - 1
+const uint8_t HISTOGRAM_BUCKETS = 33;
+
+/*
+ * Histogram of durations with power of two buckets. Recording a duration
+ * costs a count leading zeros and two increments, so it can stay enabled in
+ * the main loop.
+ */
+class Histogram {
+
+private:
+  std::array<uint32_t, HISTOGRAM_BUCKETS> buckets = {};
+  uint32_t count = 0;
+  uint32_t maximum = 0;
+
+public:
+  /*
+   * Get the bucket of the given value
+   */
+  static auto getBucketIndex(uint32_t value) -> uint8_t;
+
+  /*
+   * Get the largest value of the given bucket
+   */
+  static auto getBucketLimit(uint8_t bucket) -> uint32_t;
+
+  /*
+   * Record a duration
+   */
+  void record(uint32_t value);
+
+  /*
+   * Remove all recorded durations
+   */
+  void reset();
+
+  /*
+   * Get the number of recorded durations
+   */
+  auto getCount() const -> uint32_t;
+
+  /*
+   * Get the longest recorded duration
+   */
+  auto getMaximum() const -> uint32_t;
+
+  /*
+   * Get the number of durations recorded in the given bucket
+   */
+  auto getBucket(uint8_t bucket) const -> uint32_t;
+
+  /*
+   * Get an upper bound of the given percentile, the limit of the bucket
+   * holding it but at most the maximum. Returns zero without durations.
+   */
+  auto getPercentile(uint8_t percent) const -> uint32_t;
+
+  /*
+   * Write a one line summary with the count, p50, p99, maximum and the non
+   * empty buckets. Returns the length the full line needs, like snprintf.
+   */
+  auto format(char *buffer, size_t size) const -> int;
+};
+
+} // namespace Timing
+
+#endif
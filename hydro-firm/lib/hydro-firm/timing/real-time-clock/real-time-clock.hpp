@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TIMING_REAL_TIME_CLOCK_REAL_TIME_CLOCK_HPP
+#define TIMING_REAL_TIME_CLOCK_REAL_TIME_CLOCK_HPP
+
+#ifdef NATIVE
+
+#include <chrono>
+#include <cstdint>
+#include <timing/clock/clock.hpp>
+
+namespace Timing {
+
+/*
+ * Clock of the host on the native build. Time passes as on the wall and a
+ * delay sleeps the calling thread.
+ */
+class RealTimeClock final : public Clock {
+
+private:
+  const std::chrono::steady_clock::time_point start;
+
+public:
+  /*
+   * Constructor for a clock starting at zero
+   */
+  RealTimeClock();
+
+  /*
+   * Get the milliseconds passed since the clock was constructed
+   */
+  auto millis() const -> uint32_t override;
+
+  /*
+   * Sleep for the given number of milliseconds
+   */
+  void delay(uint32_t milliseconds) override;
+
+  /*
+   * Sleep for the given number of microseconds
+   */
+  void delayMicroseconds(uint32_t microseconds) override;
+};
+
+} // namespace Timing
+
+#endif
+
+#endif
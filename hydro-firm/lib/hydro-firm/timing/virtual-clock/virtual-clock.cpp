@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <timing/virtual-clock/virtual-clock.hpp>
+
+/*
+ * Constructor
+ */
+Timing::VirtualClock::VirtualClock(const uint32_t start) : now(start) {}
+
+/*
+ * Get the current virtual time
+ */
+auto Timing::VirtualClock::millis() const -> uint32_t { return this->now; }
+
+/*
+ * Advance the clock to the end of the delay
+ */
+void Timing::VirtualClock::delay(const uint32_t milliseconds) {
+  this->delayedMillis += milliseconds;
+  this->advance(milliseconds);
+}
+
+/*
+ * Advance the clock to the end of the delay, carrying the microseconds which
+ * do not make up a whole millisecond
+ */
+void Timing::VirtualClock::delayMicroseconds(const uint32_t microseconds) {
+  this->delayedMicros += microseconds;
+  const uint64_t pending = static_cast<uint64_t>(this->pendingMicros) + microseconds;
+  this->advance(static_cast<uint32_t>(pending / MICROS_PER_MILLI));
+  this->pendingMicros = static_cast<uint32_t>(pending % MICROS_PER_MILLI);
+}
+
+/*
+ * Advance the clock by the given number of milliseconds
+ */
+void Timing::VirtualClock::advance(const uint32_t milliseconds) { this->now += milliseconds; }
+
+/*
+ * Get the total milliseconds spent in delays
+ */
+auto Timing::VirtualClock::getDelayedMillis() const -> uint64_t { return this->delayedMillis; }
+
+/*
+ * Get the total microseconds spent in microsecond delays
+ */
+auto Timing::VirtualClock::getDelayedMicros() const -> uint64_t { return this->delayedMicros; }
@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TIMING_VIRTUAL_CLOCK_VIRTUAL_CLOCK_HPP
+#define TIMING_VIRTUAL_CLOCK_VIRTUAL_CLOCK_HPP
+
+#include <cstdint>
+#include <timing/clock/clock.hpp>
+
+namespace Timing {
+
+// Microseconds in a millisecond
+const uint32_t MICROS_PER_MILLI = 1000;
+
+/*
+ * Deterministic clock which only moves when told to. A delay returns at once
+ * with the clock advanced to its end, so hours of timed behaviour take no
+ * wall time.
+ */
+class VirtualClock final : public Clock {
+
+private:
+  uint32_t now;
+  // Microseconds waited which do not make up a whole millisecond yet
+  uint32_t pendingMicros = 0;
+  uint64_t delayedMillis = 0;
+  uint64_t delayedMicros = 0;
+
+public:
+  /*
+   * Constructor for a clock starting at the given time
+   */
+  explicit VirtualClock(uint32_t start = 0);
+
+  /*
+   * Get the current virtual time
+   */
+  auto millis() const -> uint32_t override;
+
+  /*
+   * Advance the clock to the end of the delay
+   */
+  void delay(uint32_t milliseconds) override;
+
+  /*
+   * Advance the clock to the end of the delay. Microseconds are carried
+   * until they make up a whole millisecond.
+   */
+  void delayMicroseconds(uint32_t microseconds) override;
+
+  /*
+   * Advance the clock by the given number of milliseconds
+   */
+  void advance(uint32_t milliseconds);
+
+  /*
+   * Get the total milliseconds spent in delays
+   */
+  auto getDelayedMillis() const -> uint64_t;
+
+  /*
+   * Get the total microseconds spent in microsecond delays
+   */
+  auto getDelayedMicros() const -> uint64_t;
+};
+
+} // namespace Timing
+
+#endif
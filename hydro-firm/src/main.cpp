@@ -29,55 +29,177 @@
  */
 
 #include "executor/executor.hpp"
+#include <data/log-storage/log-storage.hpp>
 #include <data/process/process.hpp>
-#include <list>
-#include <memory>
+#include <data/sample-log/sample-log.hpp>
+#include <memory/footprint/footprint.hpp>
+#include <sensors/analog-mux/analog-mux.hpp>
 #include <sensors/moisture-level/moisture-level.hpp>
 #include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/sensor-set/sensor-set.hpp>
 #include <sensors/sensor.hpp>
 #include <sensors/water-level/water-level.hpp>
 #include <system/process/process.hpp>
+#include <system/zones/zones.hpp>
+#include <telemetry/uplink/uplink.hpp>
 
 #ifdef NATIVE
 #include <ArduinoFake.h>
 #include <cstdio>
+#include <simulator/simulation/simulation.hpp>
 
 #else
 #include <Arduino.h>
+#include <cstdio>
+#include <telemetry/http-transport/http-transport.hpp>
+
+// The probes share the single ADC pin through a CD74HC4067 and are powered
+// together from D0. The select lines S0 - S3 are on D3, D4, D8 and D7: the
+// boot strap pins GPIO0, GPIO2 and GPIO15 only drive high impedance mux inputs,
+// so they keep the levels the board pulls them to at reset.
+const std::array<uint8_t, Sensors::MUX_SELECT_LINES> MUX_SELECT_PINS = {0, 2, 15, 13};
+const uint8_t PROBE_POWER_PIN = 16;
+const uint8_t MOISTURE_LEVEL_CHANNEL = 0;
+const uint8_t WATER_LEVEL_CHANNEL = 1;
+// Relays of the pump and the valve on D2 and D6, pins with no role at boot
+const uint8_t PUMP_PIN = 4;
+const uint8_t VALVE_PIN = 12;
+// The sensors and processes live for the whole program, so they are kept in
+// static storage rather than on the heap.
+Sensors::AnalogMux analogMux(MUX_SELECT_PINS);                         // NOLINT
+Sensors::MoistureLevelSensor moistureLevelSensor(A0, PROBE_POWER_PIN); // NOLINT
+Sensors::WaterLevelSensor waterLevelSensor(A0, PROBE_POWER_PIN);       // NOLINT
+#ifdef PLANT_ZONES
+// Probes of a second plant container on the next two mux channels, and its
+// relays on D5 and D1
+const uint8_t SECOND_MOISTURE_LEVEL_CHANNEL = 2;
+const uint8_t SECOND_WATER_LEVEL_CHANNEL = 3;
+const uint8_t SECOND_PUMP_PIN = 14;
+const uint8_t SECOND_VALVE_PIN = 5;
+Sensors::MoistureLevelSensor secondMoistureLevelSensor(A0, PROBE_POWER_PIN); // NOLINT
+Sensors::WaterLevelSensor secondWaterLevelSensor(A0, PROBE_POWER_PIN);       // NOLINT
+const uint8_t SENSOR_COUNT = 4;
+Sensors::SensorSet<SENSOR_COUNT> sensors = {&moistureLevelSensor, &waterLevelSensor, // NOLINT
+                                            &secondMoistureLevelSensor, &secondWaterLevelSensor};
+Sensors::ReadSensors readSensors(sensors, Sensors::BATCHED); // NOLINT
+System::Zones zones(readSensors);                            // NOLINT
+#else
+const uint8_t SENSOR_COUNT = 2;
+Sensors::SensorSet<SENSOR_COUNT> sensors = {&moistureLevelSensor, &waterLevelSensor}; // NOLINT
+Sensors::ReadSensors readSensors(sensors, Sensors::BATCHED);               // NOLINT
+System::State state(readSensors);                                          // NOLINT
+System::Controller controller(state, PUMP_PIN, VALVE_PIN);                 // NOLINT
+System::Process systemProcess(controller, state);                          // NOLINT
+#endif
+// Readings of sensors without a history would reach the uplink only
+static_assert(SENSOR_COUNT <= Data::MAX_HISTORY_SENSORS, "Build with -D HISTORY_SENSORS set to every sensor");
+// 1.5 MiB of the 2 MiB LittleFS partition in 16 KiB segment files, leaving
+// room for the file system
+const uint32_t SAMPLE_LOG_PAGE_COUNT = 6144;
+Data::FileLogStorage logStorage("/samples.log", SAMPLE_LOG_PAGE_COUNT);   // NOLINT
+Data::SampleLog sampleLog(logStorage);                                    // NOLINT
+Data::Process dataProcess(readSensors);                                   // NOLINT
+#ifdef PLANT_ZONES
+MainExecutor::BasicExecutor<Sensors::ReadSensors, System::Zones, Data::Process> executor( // NOLINT
+    readSensors, zones, dataProcess, Timing::getHardwareClock());
+#else
+MainExecutor::Executor executor(readSensors, systemProcess, dataProcess); // NOLINT
+#endif
+#ifdef TELEMETRY_URL
+#ifdef HEAP_FREE_LOOP
+// HTTPClient builds its request and response in String objects on every send
+#error "The HTTP telemetry uplink allocates in the loop and cannot be built with HEAP_FREE_LOOP"
+#endif
+#if !defined WIFI_SSID || !defined WIFI_PASSWORD
+#error "The HTTP telemetry uplink needs the WiFi network in WIFI_SSID and WIFI_PASSWORD"
+#endif
+Telemetry::HttpTransport httpTransport(TELEMETRY_URL); // NOLINT
+Telemetry::Uplink uplink(httpTransport);               // NOLINT
+#endif
+// Character requesting the stage timing report over Serial
+const int STAGE_TIMES_REQUEST = 't';
+// Length of a heap report line including the terminating null
+const size_t HEAP_LINE_LENGTH = 64;
 
-std::unique_ptr<MainExecutor::Executor> executor = nullptr; // NOLINT
+/*
+ * Print the free heap and the largest block which can still be allocated
+ */
+void printHeap() {
+  std::array<char, HEAP_LINE_LENGTH> line = {};
+  std::snprintf(line.data(), line.size(), "heap free %u B, largest block %u B, fragmentation %u%%",
+                static_cast<unsigned>(ESP.getFreeHeap()), static_cast<unsigned>(ESP.getMaxFreeBlockSize()),
+                static_cast<unsigned>(ESP.getHeapFragmentation()));
+  Serial.println(line.data());
+}
 
+/*
+ * Print the size of every object kept in static storage and the heap left
+ * after boot
+ */
+void printFootprint() {
+  Memory::FootprintReport report;
+  report.addObject("analogMux", analogMux);
+  report.addObject("moistureLevelSensor", moistureLevelSensor);
+  report.addObject("waterLevelSensor", waterLevelSensor);
+#ifdef PLANT_ZONES
+  report.addObject("secondMoistureLevelSensor", secondMoistureLevelSensor);
+  report.addObject("secondWaterLevelSensor", secondWaterLevelSensor);
 #endif
+  report.addObject("sensors", sensors);
+  report.addObject("readSensors", readSensors);
+#ifdef PLANT_ZONES
+  report.addObject("zones", zones);
+#else
+  report.addObject("state", state);
+  report.addObject("controller", controller);
+  report.addObject("systemProcess", systemProcess);
+#endif
+  report.addObject("logStorage", logStorage);
+  report.addObject("sampleLog", sampleLog);
+  report.addObject("dataProcess", dataProcess);
+  report.addObject("executor", executor);
+#ifdef TELEMETRY_URL
+  report.addObject("httpTransport", httpTransport);
+  report.addObject("uplink", uplink);
+#endif
+  report.print();
+  printHeap();
+}
 
-#if defined NATIVE
-const auto LOOP_COUNT = 10;
+#endif
 
-void run(MainExecutor::Executor const &executor, const int loopCount) {
-  // TODO(aruncs009@gmail.com): Add logging
-  executor.setup();
-  for (int i = 1; i <= loopCount; ++i) {
-    executor.loop();
-  }
-}
-#elif !UNIT_TEST
+#if !defined NATIVE && !defined UNIT_TEST
 
 /**
  * Initial setup
  */
 void setup() {
   // TODO(aruncs009@gmail.com): Add logging
-  Sensors::MoistureLevelSensor moistureLevelSensor(1, 1);
-  Sensors::WaterLevelSensor waterLevelSensor(1, 1);
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  std::list<Sensors::Sensor *> sensors = {&moistureLevelSensor, &waterLevelSensor};
-  Sensors::ReadSensors readSensors(sensors);
-  System::State state(readSensors);
-  System::Controller controller(state);
-  System::Process systemProcess(controller, state);
-  Data::Process dataProcess;
-  executor =
-      std::unique_ptr<MainExecutor::Executor>(new MainExecutor::Executor(readSensors, systemProcess, dataProcess));
-  executor->setup();
+  analogMux.begin();
+  analogMux.addSensor(moistureLevelSensor, MOISTURE_LEVEL_CHANNEL);
+  analogMux.addSensor(waterLevelSensor, WATER_LEVEL_CHANNEL);
+#ifdef PLANT_ZONES
+  analogMux.addSensor(secondMoistureLevelSensor, SECOND_MOISTURE_LEVEL_CHANNEL);
+  analogMux.addSensor(secondWaterLevelSensor, SECOND_WATER_LEVEL_CHANNEL);
+  readSensors.setAnalogMux(analogMux);
+  zones.addZone({waterLevelSensor.getId(), moistureLevelSensor.getId(), PUMP_PIN, VALVE_PIN});
+  zones.addZone({secondWaterLevelSensor.getId(), secondMoistureLevelSensor.getId(), SECOND_PUMP_PIN, SECOND_VALVE_PIN});
+#else
+  readSensors.setAnalogMux(analogMux);
+  controller.begin();
+#endif
+  sampleLog.begin();
+  dataProcess.addSampleSink(sampleLog);
+#ifdef TELEMETRY_URL
+  httpTransport.begin(WIFI_SSID, WIFI_PASSWORD);
+  dataProcess.addSampleSink(uplink);
+#endif
+#ifdef PLANT_ZONES
+  Serial.begin(MainExecutor::BAUD_RATE);
+#else
+  executor.setup();
+#endif
+  printFootprint();
 }
 
 /**
@@ -85,35 +207,48 @@ void setup() {
  */
 void loop() {
   // TODO(aruncs009@gmail.com): Add logging
-  executor->loop();
+  executor.loop();
+  if (Serial.available() > 0 && Serial.read() == STAGE_TIMES_REQUEST) {
+    executor.printStageTimes();
+#ifdef HEAP_FREE_LOOP
+    // Unchanged from boot as long as nothing in the loop allocates
+    printHeap();
+#endif
+  }
 }
 
 #endif
 
 #if defined NATIVE && !defined UNIT_TEST
 
-void configureArduinoFake() {
-  fakeit::When(OverloadedMethod(ArduinoFake(Serial), begin, void(unsigned long))).AlwaysReturn();
-  fakeit::When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
-  fakeit::When(Method(ArduinoFake(), delay)).AlwaysReturn();
-  fakeit::When(Method(ArduinoFake(), analogRead)).AlwaysReturn(123);
+// Days of operation simulated by the native program
+const uint32_t SIMULATED_DAYS = 30;
+
+// The firmware has no cool down timer yet, the simulation stands in for it
+const uint32_t COOL_DOWN_PERIOD = 12 * Simulator::HOUR_MILLIS;
+
+auto toHours(const uint64_t milliseconds) -> double {
+  return static_cast<double>(milliseconds) / Simulator::HOUR_MILLIS;
+}
+
+void printReport(const Simulator::SimulationReport &report) {
+  std::printf("Simulated hours:       %.1f\n", toHours(report.simulatedMillis));
+  std::printf("Pump cycles:           %u\n", static_cast<unsigned>(report.pumpCycles));
+  std::printf("Pump on hours:         %.2f\n", toHours(report.pumpOnMillis));
+  std::printf("Forced watering hours: %.2f\n", toHours(report.modeMillis[System::FORCED_WATERING_MODE]));
+  std::printf("Active hours:          %.2f\n", toHours(report.modeMillis[System::ACTIVE_MODE]));
+  std::printf("Cool down hours:       %.2f\n", toHours(report.modeMillis[System::COOL_DOWN_MODE]));
+  std::printf("Overflow events:       %u\n", static_cast<unsigned>(report.overflowEvents));
+  std::printf("Spilled litres:        %.2f\n", static_cast<double>(report.spilledVolume));
+  std::printf("Evaluated passes:      %u\n", static_cast<unsigned>(report.evaluatedPasses));
+  std::printf("Skipped passes:        %u\n", static_cast<unsigned>(report.skippedPasses));
 }
 
 auto main() -> int {
-  configureArduinoFake();
   // TODO(aruncs009@gmail.com): Add logging
-  Sensors::MoistureLevelSensor moistureLevelSensor(1, 1);
-  Sensors::WaterLevelSensor waterLevelSensor(1, 1);
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  std::list<Sensors::Sensor *> sensors = {&moistureLevelSensor, &waterLevelSensor};
-  Sensors::ReadSensors readSensors(sensors);
-
-  System::State state(readSensors);
-  System::Controller controller(state);
-  System::Process systemProcess(controller, state);
-  Data::Process dataProcess;
-  MainExecutor::Executor executor(readSensors, systemProcess, dataProcess);
-  run(executor, LOOP_COUNT);
+  Simulator::Simulation simulation(Simulator::DEFAULT_TANK, COOL_DOWN_PERIOD);
+  simulation.run(SIMULATED_DAYS * Simulator::DAY_MILLIS);
+  printReport(simulation.getReport());
   return 0;
 }
 
@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "allocation-tracker.hpp"
+
+#ifdef NATIVE
+
+namespace {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+AllocationTracker::AllocationCount testStart = {0, 0};
+
+/*
+ * Marks the start of every test for AllocationTracker::getTestTotal()
+ */
+class TestStartListener : public ::testing::EmptyTestEventListener {
+  void OnTestStart(const ::testing::TestInfo & /*testInfo*/) override { testStart = AllocationTracker::getTotal(); }
+};
+
+/*
+ * Registers the listener before the tests run
+ */
+struct TestStartRegistration {
+  TestStartRegistration() {
+    ::testing::UnitTest::GetInstance()->listeners().Append(new TestStartListener()); // NOLINT
+  }
+};
+
+const TestStartRegistration testStartRegistration;
+
+} // namespace
+
+auto AllocationTracker::getTestTotal() -> AllocationCount {
+  const AllocationCount total = getTotal();
+  return {total.allocations - testStart.allocations, total.bytes - testStart.bytes};
+}
+
+#endif
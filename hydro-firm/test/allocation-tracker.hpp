@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TEST_ALLOCATION_TRACKER_HPP
+#define TEST_ALLOCATION_TRACKER_HPP
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory/allocation-counter/allocation-counter.hpp>
+
+/*
+ * Heap allocation checks for the native tests, on the allocation counter of
+ * Memory which every test program links
+ */
+namespace AllocationTracker {
+
+using AllocationCount = Memory::AllocationCount;
+using Scope = Memory::AllocationScope;
+using StackCapture = Memory::AllocationStackCapture;
+
+/*
+ * Get the allocations made by the program so far
+ */
+inline auto getTotal() -> AllocationCount { return Memory::getAllocationTotal(); }
+
+/*
+ * Get the allocations made since the running test started
+ */
+auto getTestTotal() -> AllocationCount;
+
+/*
+ * Run the given function once and get the allocations it made. Call it with
+ * the loop of an executor to count the allocations of one iteration.
+ */
+template <typename Function> auto count(Function function) -> AllocationCount {
+  const Scope scope;
+  function();
+  return {scope.getAllocations(), scope.getBytes()};
+}
+
+} // namespace AllocationTracker
+
+/*
+ * Expect the statement to make exactly the given number of allocations
+ */
+#define EXPECT_ALLOCATIONS(expected, statement)                                                                        \
+  do {                                                                                                                 \
+    const AllocationTracker::Scope allocationScope;                                                                    \
+    statement;                                                                                                         \
+    const uint64_t allocations = allocationScope.getAllocations();                                                     \
+    EXPECT_EQ(allocations, static_cast<uint64_t>(expected)) << "Allocations made by " #statement;                      \
+  } while (false)
+
+/*
+ * Expect the statement to make no allocation
+ */
+#define EXPECT_NO_ALLOCATIONS(statement) EXPECT_ALLOCATIONS(0, statement)
+
+#endif
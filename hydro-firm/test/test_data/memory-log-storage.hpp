@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TEST_DATA_MEMORY_LOG_STORAGE_HPP
+#define TEST_DATA_MEMORY_LOG_STORAGE_HPP
+
+#include <algorithm>
+#include <array>
+#include <data/log-storage/log-storage.hpp>
+
+/*
+ * Log storage of the given number of pages kept in memory, optionally failing
+ * all operations
+ */
+template <uint32_t PAGE_COUNT> class MemoryLogStorage final : public Data::LogStorage {
+public:
+  std::array<std::array<uint8_t, Data::LOG_PAGE_SIZE>, PAGE_COUNT> pages = {};
+  std::array<bool, PAGE_COUNT> written = {};
+  uint32_t writeCount = 0;
+  bool failing = false;
+
+  auto begin() -> bool override { return !this->failing; }
+  auto getPageCount() const -> uint32_t override { return PAGE_COUNT; }
+  auto writePage(const uint32_t slot, const uint8_t *page) -> bool override {
+    if (this->failing) {
+      return false;
+    }
+    std::copy(page, page + Data::LOG_PAGE_SIZE, this->pages.at(slot).begin()); // NOLINT
+    this->written.at(slot) = true;
+    ++this->writeCount;
+    return true;
+  }
+  auto readPage(const uint32_t slot, uint8_t *page) -> bool override {
+    std::copy(this->pages.at(slot).begin(), this->pages.at(slot).end(), page);
+    return this->written.at(slot);
+  }
+};
+
+#endif
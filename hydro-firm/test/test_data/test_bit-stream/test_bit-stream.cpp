@@ -0,0 +1,107 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <data/bit-stream/bit-stream.hpp>
+#include <gtest/gtest.h>
+#include <tuple>
+
+#ifdef NATIVE
+
+namespace {
+
+class ZigZagTest : public testing::TestWithParam<std::tuple<int32_t, uint32_t>> {};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables, modernize-use-trailing-return-type)
+INSTANTIATE_TEST_SUITE_P(ZigZagValues, ZigZagTest,
+                         testing::Values(std::make_tuple(0, 0U), std::make_tuple(-1, 1U), std::make_tuple(1, 2U),
+                                         std::make_tuple(-2, 3U), std::make_tuple(INT32_MAX, UINT32_MAX - 1),
+                                         std::make_tuple(INT32_MIN, UINT32_MAX)));
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_P(ZigZagTest, IsZigZagEncodingWorking) {                                                           // NOLINT
+  EXPECT_EQ(Data::zigZagEncode(std::get<0>(GetParam())), std::get<1>(GetParam())) << "Incorrect code";  // NOLINT
+  EXPECT_EQ(Data::zigZagDecode(std::get<1>(GetParam())), std::get<0>(GetParam())) << "Incorrect value"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(BitStreamTest, AreValuesReadBackInOrder) { // NOLINT
+  std::array<uint8_t, 8> buffer = {};
+  buffer.fill(0xFF);
+  Data::BitWriter writer(buffer.data(), buffer.size());
+  EXPECT_TRUE(writer.write(0, 1)) << "Bit not written";            // NOLINT
+  EXPECT_TRUE(writer.write(5, 3)) << "Bits not written";           // NOLINT
+  EXPECT_TRUE(writer.write(UINT32_MAX, 32)) << "Word not written"; // NOLINT
+  EXPECT_TRUE(writer.write(0x2A, 7)) << "Bits not written";        // NOLINT
+  EXPECT_EQ(writer.getPosition(), 43) << "Incorrect position";     // NOLINT
+  EXPECT_EQ(writer.getRemaining(), 21) << "Incorrect remaining";   // NOLINT
+
+  Data::BitReader reader(buffer.data(), buffer.size());
+  uint32_t value = 0;
+  EXPECT_TRUE(reader.read(1, value)) << "Bit not read";   // NOLINT
+  EXPECT_EQ(value, 0) << "Incorrect bit";                 // NOLINT
+  EXPECT_TRUE(reader.read(3, value)) << "Bits not read";  // NOLINT
+  EXPECT_EQ(value, 5) << "Incorrect bits";                // NOLINT
+  EXPECT_TRUE(reader.read(32, value)) << "Word not read"; // NOLINT
+  EXPECT_EQ(value, UINT32_MAX) << "Incorrect word";       // NOLINT
+  EXPECT_TRUE(reader.read(7, value)) << "Bits not read";  // NOLINT
+  EXPECT_EQ(value, 0x2A) << "Incorrect bits";             // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(BitStreamTest, IsOverflowRejected) { // NOLINT
+  std::array<uint8_t, 1> buffer = {};
+  Data::BitWriter writer(buffer.data(), buffer.size());
+  EXPECT_TRUE(writer.write(1, 6)) << "Bits not written";               // NOLINT
+  EXPECT_FALSE(writer.write(3, 3)) << "Bits written past the end";     // NOLINT
+  EXPECT_EQ(writer.getPosition(), 6) << "Failed write moved position"; // NOLINT
+
+  Data::BitReader reader(buffer.data(), buffer.size());
+  uint32_t value = 0;
+  EXPECT_TRUE(reader.read(6, value)) << "Bits not read";           // NOLINT
+  EXPECT_FALSE(reader.read(3, value)) << "Bits read past the end"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(BitStreamTest, IsRewindDroppingBits) { // NOLINT
+  std::array<uint8_t, 1> buffer = {};
+  Data::BitWriter writer(buffer.data(), buffer.size());
+  writer.write(0x7, 3);
+  writer.rewind(1);
+  EXPECT_EQ(writer.getPosition(), 1) << "Rewind did not move back"; // NOLINT
+  writer.rewind(5);
+  EXPECT_EQ(writer.getPosition(), 1) << "Rewind moved forward"; // NOLINT
+  writer.write(0, 2);
+  EXPECT_EQ(buffer[0], 0x80) << "Rewound bits not overwritten"; // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/history/history.hpp>
+#include <gtest/gtest.h>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t SAMPLE_PERIOD = 1000;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HistoryTest, IsRawHistoryBounded) { // NOLINT
+  Data::SensorHistory history;
+  for (uint32_t index = 0; index < Data::RAW_HISTORY_LENGTH + 10; ++index) {
+    history.record(index * SAMPLE_PERIOD, static_cast<int16_t>(index));
+  }
+  EXPECT_EQ(history.getRaw().size(), Data::RAW_HISTORY_LENGTH) << "Raw history grew beyond its length"; // NOLINT
+  EXPECT_EQ(history.getRaw()[0].value, 10) << "Oldest raw sample not dropped";                          // NOLINT
+  EXPECT_EQ(history.getRaw().latest().timestamp, (Data::RAW_HISTORY_LENGTH + 9) * SAMPLE_PERIOD)        // NOLINT
+      << "Incorrect timestamp of the latest sample";
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HistoryTest, AreMinuteAggregatesCompleted) { // NOLINT
+  Data::SensorHistory history;
+  history.record(0, 10);
+  history.record(Data::MINUTE_MILLIS / 2, 30);
+  history.record(Data::MINUTE_MILLIS - 1, 20);
+  EXPECT_EQ(history.getMinutes().size(), 0) << "Minute completed early"; // NOLINT
+
+  history.record(Data::MINUTE_MILLIS, 50);
+  ASSERT_EQ(history.getMinutes().size(), 1) << "Minute not completed";             // NOLINT
+  EXPECT_EQ(history.getMinutes()[0].timestamp, 0) << "Incorrect minute timestamp"; // NOLINT
+  EXPECT_EQ(history.getMinutes()[0].minimum, 10) << "Incorrect minute minimum";    // NOLINT
+  EXPECT_EQ(history.getMinutes()[0].maximum, 30) << "Incorrect minute maximum";    // NOLINT
+  EXPECT_EQ(history.getMinutes()[0].mean, 20) << "Incorrect minute mean";          // NOLINT
+  EXPECT_EQ(history.getHours().size(), 0) << "Hour completed early";               // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HistoryTest, AreHourAggregatesCompleted) { // NOLINT
+  Data::SensorHistory history;
+  for (uint32_t timestamp = 0; timestamp <= Data::HOUR_MILLIS; timestamp += Data::MINUTE_MILLIS) {
+    history.record(timestamp, static_cast<int16_t>(timestamp / Data::MINUTE_MILLIS));
+  }
+  ASSERT_EQ(history.getHours().size(), 1) << "Hour not completed";                   // NOLINT
+  EXPECT_EQ(history.getHours()[0].minimum, 0) << "Incorrect hour minimum";           // NOLINT
+  EXPECT_EQ(history.getHours()[0].maximum, 59) << "Incorrect hour maximum";          // NOLINT
+  EXPECT_EQ(history.getHours()[0].mean, 29) << "Incorrect hour mean";                // NOLINT
+  EXPECT_EQ(history.getMinutes().size(), 60) << "Incorrect number of minutes";       // NOLINT
+  EXPECT_EQ(history.getMinutes().latest().mean, 59) << "Incorrect last minute mean"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HistoryTest, AreSensorsWithoutHistoryRejected) { // NOLINT
+  Data::History history;
+  EXPECT_TRUE(history.record(0, 0, 1)) << "Reading not recorded";                                      // NOLINT
+  EXPECT_FALSE(history.record(Data::MAX_HISTORY_SENSORS, 0, 1)) << "Reading recorded without history"; // NOLINT
+  EXPECT_EQ(history.getSensorHistory(Data::MAX_HISTORY_SENSORS), nullptr) << "History found";          // NOLINT
+  ASSERT_NE(history.getSensorHistory(0), nullptr) << "History not found";                              // NOLINT
+  EXPECT_EQ(history.getSensorHistory(0)->getRaw().size(), 1) << "Incorrect number of samples";         // NOLINT
+  EXPECT_LE(Data::HISTORY_MEMORY_SIZE, Data::HISTORY_MEMORY_BUDGET) << "History exceeds its budget";   // NOLINT
+}
+
+} // namespace
+
+#endif
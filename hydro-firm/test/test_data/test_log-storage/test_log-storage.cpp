@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <cstdio>
+#include <data/log-storage/log-storage.hpp>
+#include <gtest/gtest.h>
+
+#ifdef NATIVE
+
+namespace {
+
+const char *const LOG_PATH = "test-log-storage.log";
+const uint32_t PAGE_COUNT = 4;
+const uint32_t SEGMENT_PAGE_COUNT = 2;
+
+/*
+ * Get the size of the file at the given path, or -1 if it does not exist
+ */
+auto getFileSize(const char *path) -> long {
+  std::FILE *file = std::fopen(path, "rb"); // NOLINT(cppcoreguidelines-owning-memory)
+  if (file == nullptr) {
+    return -1;
+  }
+  std::fseek(file, 0, SEEK_END);
+  const long size = std::ftell(file);
+  std::fclose(file); // NOLINT(cppcoreguidelines-owning-memory)
+  return size;
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(FileLogStorageTest, ArePagesPersisted) { // NOLINT
+  std::array<uint8_t, Data::LOG_PAGE_SIZE> page = {};
+  page.fill(0x5A);
+  {
+    Data::FileLogStorage storage(LOG_PATH, PAGE_COUNT);
+    storage.erase();
+    ASSERT_TRUE(storage.begin()) << "Storage not created";                   // NOLINT
+    EXPECT_EQ(storage.getPageCount(), PAGE_COUNT) << "Incorrect page count"; // NOLINT
+    EXPECT_FALSE(storage.readPage(0, page.data())) << "Unwritten page read"; // NOLINT
+    page.fill(0x5A);
+    EXPECT_TRUE(storage.writePage(1, page.data())) << "Page not written";                    // NOLINT
+    EXPECT_FALSE(storage.writePage(PAGE_COUNT, page.data())) << "Page written out of range"; // NOLINT
+  }
+
+  Data::FileLogStorage storage(LOG_PATH, PAGE_COUNT);
+  ASSERT_TRUE(storage.begin()) << "Storage not opened"; // NOLINT
+  page.fill(0);
+  EXPECT_TRUE(storage.readPage(1, page.data())) << "Page not read";                    // NOLINT
+  EXPECT_EQ(page[Data::LOG_PAGE_SIZE - 1], 0x5A) << "Incorrect page content";          // NOLINT
+  EXPECT_TRUE(storage.readPage(0, page.data())) << "Gap before the page not read";     // NOLINT
+  EXPECT_FALSE(storage.readPage(PAGE_COUNT, page.data())) << "Page read out of range"; // NOLINT
+  storage.erase();
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(FileLogStorageTest, IsUnavailableStorageReported) { // NOLINT
+  std::array<uint8_t, Data::LOG_PAGE_SIZE> page = {};
+  Data::FileLogStorage storage("missing-directory/test-log-storage.log", PAGE_COUNT);
+  EXPECT_FALSE(storage.writePage(0, page.data())) << "Page written before begin"; // NOLINT
+  EXPECT_FALSE(storage.readPage(0, page.data())) << "Page read before begin";     // NOLINT
+  EXPECT_FALSE(storage.begin()) << "Storage opened in a missing directory";       // NOLINT
+  EXPECT_FALSE(storage.writePage(0, page.data())) << "Page written without file"; // NOLINT
+}
+
+TEST(FileLogStorageTest, IsWrappingIntoFreshSegment) { // NOLINT
+  std::array<uint8_t, Data::LOG_PAGE_SIZE> page = {};
+  Data::FileLogStorage storage(LOG_PATH, PAGE_COUNT, SEGMENT_PAGE_COUNT);
+  storage.erase();
+  ASSERT_TRUE(storage.begin()) << "Storage not created"; // NOLINT
+  for (uint32_t slot = 0; slot < PAGE_COUNT; ++slot) {
+    page.fill(static_cast<uint8_t>(slot));
+    EXPECT_TRUE(storage.writePage(slot, page.data())) << "Page not written"; // NOLINT
+  }
+  const long segmentSize = static_cast<long>(SEGMENT_PAGE_COUNT * Data::LOG_PAGE_SIZE);
+  EXPECT_EQ(getFileSize("test-log-storage.log.0"), segmentSize) << "First segment not full";  // NOLINT
+  EXPECT_EQ(getFileSize("test-log-storage.log.1"), segmentSize) << "Second segment not full"; // NOLINT
+  EXPECT_EQ(getFileSize(LOG_PATH), -1) << "Pages written outside of the segments";            // NOLINT
+
+  page.fill(PAGE_COUNT);
+  EXPECT_TRUE(storage.writePage(0, page.data())) << "Wrapped page not written";                     // NOLINT
+  EXPECT_EQ(getFileSize("test-log-storage.log.0"), Data::LOG_PAGE_SIZE) << "Segment not restarted"; // NOLINT
+  EXPECT_FALSE(storage.readPage(1, page.data())) << "Dropped page read";                            // NOLINT
+  EXPECT_TRUE(storage.readPage(0, page.data())) << "Wrapped page not read";                         // NOLINT
+  EXPECT_EQ(page[0], PAGE_COUNT) << "Incorrect wrapped page content";                               // NOLINT
+  EXPECT_TRUE(storage.readPage(3, page.data())) << "Page of the other segment not read";            // NOLINT
+  EXPECT_EQ(page[0], 3) << "Other segment changed";                                                 // NOLINT
+  storage.erase();
+  EXPECT_EQ(getFileSize("test-log-storage.log.1"), -1) << "Segment not erased"; // NOLINT
+}
+
+} // namespace
+
+#endif
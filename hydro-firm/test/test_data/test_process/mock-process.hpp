@@ -39,7 +39,9 @@
 class MockDataProcess : public Data::Process {
 public:
   // NOLINTNEXTLINE
-  MOCK_METHOD(void, run, (), (const, override));
+  explicit MockDataProcess(const Sensors::ReadSensors &readSensors) : Data::Process(readSensors) {}
+  // NOLINTNEXTLINE
+  MOCK_METHOD(void, run, (), (override));
 };
 
 #endif
\ No newline at end of file
@@ -28,17 +28,191 @@
  * @since: 02-10-2022
  */
 
+#include "../../test_sensors/mock-sensors.hpp"
 #include <ArduinoFake.h>
+#include <array>
+#include <data/log-storage/log-storage.hpp>
 #include <data/process/process.hpp>
+#include <data/sample-log/sample-log.hpp>
 #include <gmock/gmock.h>
 #include <memory>
+#include <timing/virtual-clock/virtual-clock.hpp>
 
 #ifdef NATIVE
 
 namespace {
+
+using ::testing::Exactly;
+using ::testing::Return;
+
+const int READING = 512;
+const char *const SAMPLE_LOG_PATH = "test-data-process.log";
+
 TEST(DataProcessTest, IsRunWorking) { // NOLINT
-  auto process = std::unique_ptr<Data::Process>(new Data::Process());
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors);
+  auto process = std::unique_ptr<Data::Process>(new Data::Process(readSensors));
+  process->run();
+  EXPECT_EQ(process->getProcessedSequence(), 0) << "Processed a snapshot before any was published"; // NOLINT
+}
+
+TEST(DataProcessTest, IsRunProcessingEachSnapshotOnce) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(0);
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors);
+  auto process = std::unique_ptr<Data::Process>(new Data::Process(readSensors));
+  readSensors.readAllSensors();
+  process->run();
+  EXPECT_EQ(process->getProcessedSequence(), 1) << "Published snapshot not processed"; // NOLINT
+  process->run();
+  EXPECT_EQ(process->getProcessedSequence(), 1) << "Snapshot processed twice"; // NOLINT
+  readSensors.readAllSensors();
+  readSensors.readAllSensors();
   process->run();
+  EXPECT_EQ(process->getProcessedSequence(), 3) << "Latest snapshot not processed"; // NOLINT
+}
+
+TEST(DataProcessTest, IsRunRecordingHistory) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), millis)).Return(1000, 2000);
+  MockSensor mockSensor("Sensor", 1, 2);
+  Sensors::SensorSet<1> sensors = {&mockSensor};
+  Sensors::ReadSensors readSensors(sensors);
+  auto process = std::unique_ptr<Data::Process>(new Data::Process(readSensors));
+  EXPECT_CALL(mockSensor, readSensor()).Times(Exactly(2));
+  EXPECT_CALL(mockSensor, getReading()).Times(2).WillOnce(Return(READING)).WillOnce(Return(READING + 1));
+  readSensors.readAllSensors();
+  process->run();
+  process->run();
+  readSensors.readAllSensors();
+  process->run();
+
+  const Data::SensorHistory *history = process->getHistory().getSensorHistory(mockSensor.getId());
+  ASSERT_NE(history, nullptr) << "No history for the sensor";                      // NOLINT
+  ASSERT_EQ(history->getRaw().size(), 2) << "Incorrect number of samples";         // NOLINT
+  EXPECT_EQ(history->getRaw()[0].timestamp, 1000) << "Incorrect sample timestamp"; // NOLINT
+  EXPECT_EQ(history->getRaw()[0].value, READING) << "Incorrect sample value";      // NOLINT
+  EXPECT_EQ(history->getRaw()[1].timestamp, 2000) << "Incorrect sample timestamp"; // NOLINT
+  EXPECT_EQ(history->getRaw()[1].value, READING + 1) << "Incorrect sample value";  // NOLINT
+  Verify(Method(ArduinoFake(), millis)).Twice();
+}
+
+TEST(DataProcessTest, IsRunTimestampingWithTheGivenClock) { // NOLINT
+  ArduinoFakeReset();
+  const uint32_t start = 5000;
+  Timing::VirtualClock clock(start);
+  MockSensor mockSensor("Sensor", 1, 2);
+  Sensors::SensorSet<1> sensors = {&mockSensor};
+  Sensors::ReadSensors readSensors(sensors);
+  Data::Process process(readSensors, clock);
+  EXPECT_CALL(mockSensor, readSensor()).Times(Exactly(1));
+  EXPECT_CALL(mockSensor, getReading()).Times(1).WillOnce(Return(READING));
+  readSensors.readAllSensors();
+  process.run();
+
+  const Data::SensorHistory *history = process.getHistory().getSensorHistory(mockSensor.getId());
+  ASSERT_NE(history, nullptr) << "No history for the sensor";                         // NOLINT
+  EXPECT_EQ(history->getRaw()[0].timestamp, start) << "Sample must carry clock time"; // NOLINT
+  Verify(Method(ArduinoFake(), millis)).Never();
+}
+
+TEST(DataProcessTest, IsRunUpdatingStatistics) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(0);
+  MockSensor firstSensor("First Sensor", 1, 2);
+  MockSensor secondSensor("Second Sensor", 1, 2);
+  MockSensor thirdSensor("Third Sensor", 1, 2);
+  Sensors::SensorSet<3> sensors = {&firstSensor, &secondSensor, &thirdSensor};
+  Sensors::ReadSensors readSensors(sensors);
+  auto process = std::unique_ptr<Data::Process>(new Data::Process(readSensors));
+  EXPECT_CALL(firstSensor, readSensor()).Times(Exactly(1));
+  EXPECT_CALL(firstSensor, getReading()).WillOnce(Return(READING));
+  EXPECT_CALL(secondSensor, readSensor()).Times(Exactly(1));
+  EXPECT_CALL(secondSensor, getReading()).WillOnce(Return(READING));
+  EXPECT_CALL(thirdSensor, readSensor()).Times(Exactly(1));
+  EXPECT_CALL(thirdSensor, getReading()).WillOnce(Return(READING));
+  readSensors.readAllSensors();
+  process->run();
+
+  const Data::SensorStatistics *statistics = process->getStatistics(firstSensor.getId());
+  ASSERT_NE(statistics, nullptr) << "No statistics for the sensor";                                      // NOLINT
+  EXPECT_EQ(statistics->getCount(), 1) << "Incorrect number of readings";                                // NOLINT
+  EXPECT_EQ(statistics->getEwma(), READING) << "Incorrect moving average";                               // NOLINT
+  EXPECT_EQ(process->getStatistics(Data::MAX_HISTORY_SENSORS), nullptr) << "Statistics beyond capacity"; // NOLINT
+}
+
+TEST(DataProcessTest, IsRunAppendingToSampleLog) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(0);
+  Data::FileLogStorage logStorage(SAMPLE_LOG_PATH, 1);
+  logStorage.erase();
+  Data::SampleLog sampleLog(logStorage);
+  ASSERT_TRUE(sampleLog.begin()) << "Sample log not started"; // NOLINT
+  MockSensor mockSensor("Sensor", 1, 2);
+  Sensors::SensorSet<1> sensors = {&mockSensor};
+  Sensors::ReadSensors readSensors(sensors);
+  auto process = std::unique_ptr<Data::Process>(new Data::Process(readSensors));
+  EXPECT_TRUE(process->addSampleSink(sampleLog)) << "Sample log not added"; // NOLINT
+  EXPECT_CALL(mockSensor, readSensor()).Times(Exactly(1));
+  EXPECT_CALL(mockSensor, getReading()).WillOnce(Return(READING));
+  readSensors.readAllSensors();
+  process->run();
+  EXPECT_TRUE(sampleLog.flush()) << "Sample log not flushed";               // NOLINT
+  EXPECT_EQ(sampleLog.getWrittenPages(), 1) << "Reading not in sample log"; // NOLINT
+  logStorage.erase();
+}
+
+TEST(DataProcessTest, IsRunRecordingFourSensors) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(0);
+  const uint8_t sensorCount = 4;
+  ASSERT_GE(Data::MAX_HISTORY_SENSORS, sensorCount) << "Tests must be built with HISTORY_SENSORS=4"; // NOLINT
+  Data::FileLogStorage logStorage(SAMPLE_LOG_PATH, sensorCount);
+  logStorage.erase();
+  Data::SampleLog sampleLog(logStorage);
+  ASSERT_TRUE(sampleLog.begin()) << "Sample log not started"; // NOLINT
+  MockSensor firstWaterLevel("Water 1", 1, 2);
+  MockSensor firstMoistureLevel("Moisture 1", 1, 2);
+  MockSensor secondWaterLevel("Water 2", 1, 2);
+  MockSensor secondMoistureLevel("Moisture 2", 1, 2);
+  const std::array<MockSensor *, sensorCount> mockSensors = {
+      {&firstWaterLevel, &firstMoistureLevel, &secondWaterLevel, &secondMoistureLevel}};
+  Sensors::SensorSet<sensorCount> sensors = {&firstWaterLevel, &firstMoistureLevel, &secondWaterLevel,
+                                             &secondMoistureLevel};
+  Sensors::ReadSensors readSensors(sensors);
+  Data::Process process(readSensors);
+  process.addSampleSink(sampleLog);
+  for (MockSensor *mockSensor : mockSensors) {
+    EXPECT_CALL(*mockSensor, readSensor()).Times(Exactly(1));
+    EXPECT_CALL(*mockSensor, getReading()).WillOnce(Return(READING + mockSensor->getId()));
+  }
+  readSensors.readAllSensors();
+  process.run();
+
+  for (MockSensor *mockSensor : mockSensors) {
+    const Data::SensorHistory *history = process.getHistory().getSensorHistory(mockSensor->getId());
+    ASSERT_NE(history, nullptr) << "No history for sensor " << +mockSensor->getId();        // NOLINT
+    EXPECT_EQ(history->getRaw()[0].value, READING + mockSensor->getId()) << "Wrong sample"; // NOLINT
+    const Data::SensorStatistics *statistics = process.getStatistics(mockSensor->getId());
+    ASSERT_NE(statistics, nullptr) << "No statistics for sensor " << +mockSensor->getId(); // NOLINT
+    EXPECT_EQ(statistics->getEwma(), READING + mockSensor->getId()) << "Wrong average";    // NOLINT
+  }
+  EXPECT_TRUE(sampleLog.flush()) << "Sample log not flushed";                           // NOLINT
+  EXPECT_EQ(sampleLog.getWrittenPages(), sensorCount) << "Every sensor must be logged"; // NOLINT
+  logStorage.erase();
+}
+
+TEST(DataProcessTest, AreSampleSinksBounded) { // NOLINT
+  Data::FileLogStorage logStorage(SAMPLE_LOG_PATH, 1);
+  Data::SampleLog sampleLog(logStorage);
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors);
+  auto process = std::unique_ptr<Data::Process>(new Data::Process(readSensors));
+  for (uint8_t sink = 0; sink < Data::MAX_SAMPLE_SINKS; ++sink) {
+    EXPECT_TRUE(process->addSampleSink(sampleLog)) << "Sample sink not added"; // NOLINT
+  }
+  EXPECT_FALSE(process->addSampleSink(sampleLog)) << "Sample sink added beyond capacity"; // NOLINT
 }
 } // namespace
 #endif
\ No newline at end of file
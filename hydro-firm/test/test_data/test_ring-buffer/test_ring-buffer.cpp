@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/ring-buffer/ring-buffer.hpp>
+#include <gtest/gtest.h>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint16_t CAPACITY = 3;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RingBufferTest, IsPushKeepingInsertionOrder) { // NOLINT
+  Data::RingBuffer<int, CAPACITY> buffer;
+  EXPECT_EQ(buffer.size(), 0) << "New buffer is not empty"; // NOLINT
+  buffer.push(1);
+  buffer.push(2);
+  EXPECT_EQ(buffer.size(), 2) << "Incorrect number of items"; // NOLINT
+  EXPECT_EQ(buffer[0], 1) << "Incorrect oldest item";         // NOLINT
+  EXPECT_EQ(buffer[1], 2) << "Incorrect newest item";         // NOLINT
+  EXPECT_EQ(buffer.latest(), 2) << "Incorrect latest item";   // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RingBufferTest, IsPushOverwritingOldestWhenFull) { // NOLINT
+  Data::RingBuffer<int, CAPACITY> buffer;
+  for (int item = 1; item <= CAPACITY + 2; ++item) {
+    buffer.push(item);
+  }
+  EXPECT_EQ(buffer.size(), CAPACITY) << "Buffer grew beyond capacity"; // NOLINT
+  EXPECT_EQ(buffer.capacity(), CAPACITY) << "Incorrect capacity";      // NOLINT
+  EXPECT_EQ(buffer[0], 3) << "Oldest item not overwritten";            // NOLINT
+  EXPECT_EQ(buffer[CAPACITY - 1], 5) << "Incorrect newest item";       // NOLINT
+  EXPECT_EQ(buffer.latest(), 5) << "Incorrect latest item";            // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RingBufferTest, IsClearWorking) { // NOLINT
+  Data::RingBuffer<int, CAPACITY> buffer;
+  buffer.push(1);
+  buffer.clear();
+  EXPECT_EQ(buffer.size(), 0) << "Buffer not empty after clear"; // NOLINT
+  buffer.push(2);
+  EXPECT_EQ(buffer[0], 2) << "Incorrect item after clear"; // NOLINT
+}
+
+} // namespace
+
+#endif
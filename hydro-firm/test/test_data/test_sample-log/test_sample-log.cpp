@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../memory-log-storage.hpp"
+#include <array>
+#include <data/sample-log/sample-log.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t SAMPLE_PERIOD = 1000;
+const uint32_t PAGE_COUNT = 3;
+const uint32_t SEQUENCE = 7;
+const Sensors::SENSOR_ID SENSOR_ID = 1;
+
+/*
+ * Read all samples of a page
+ */
+auto decodePage(const uint8_t *page) -> std::vector<Data::Sample> {
+  Data::PageDecoder decoder(page);
+  std::vector<Data::Sample> samples;
+  Data::Sample sample = {};
+  while (decoder.next(sample)) {
+    samples.push_back(sample);
+  }
+  return samples;
+}
+
+/*
+ * Record steady readings of the sensor until the given number of pages was
+ * written
+ */
+void recordPages(Data::SampleLog &sampleLog, const uint32_t pageCount, uint32_t &timestamp) {
+  const uint32_t writtenPages = sampleLog.getWrittenPages() + pageCount;
+  while (sampleLog.getWrittenPages() < writtenPages) {
+    sampleLog.record(0, timestamp, 500);
+    timestamp += SAMPLE_PERIOD;
+  }
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SampleLogTest, AreSamplesDecodedFromPage) { // NOLINT
+  const std::vector<Data::Sample> samples = {
+      {1000, 512},  {2000, 512},    {3001, 515},          {3999, 500},   {5000, 0},
+      {6000, 1023}, {70000, -1023}, {UINT32_MAX, INT16_MIN}, {5, INT16_MAX}, {6, 0}};
+  Data::PageEncoder encoder;
+  encoder.start(SENSOR_ID, samples[0].timestamp, samples[0].value);
+  for (size_t index = 1; index < samples.size(); ++index) {
+    ASSERT_TRUE(encoder.append(samples[index].timestamp, samples[index].value)) << "Sample not added"; // NOLINT
+  }
+  EXPECT_EQ(encoder.getSampleCount(), samples.size()) << "Incorrect number of samples"; // NOLINT
+
+  const uint8_t *page = encoder.finish(SEQUENCE);
+  const Data::PageDecoder decoder(page);
+  EXPECT_TRUE(decoder.isValid()) << "Page not valid";                                   // NOLINT
+  EXPECT_EQ(decoder.getSensorId(), SENSOR_ID) << "Incorrect sensor";                    // NOLINT
+  EXPECT_EQ(decoder.getSequence(), SEQUENCE) << "Incorrect sequence";                   // NOLINT
+  EXPECT_EQ(decoder.getSampleCount(), samples.size()) << "Incorrect number of samples"; // NOLINT
+  const std::vector<Data::Sample> decoded = decodePage(page);
+  ASSERT_EQ(decoded.size(), samples.size()) << "Incorrect number of decoded samples"; // NOLINT
+  for (size_t index = 0; index < samples.size(); ++index) {
+    EXPECT_EQ(decoded[index].timestamp, samples[index].timestamp) << "Incorrect timestamp at " << index; // NOLINT
+    EXPECT_EQ(decoded[index].value, samples[index].value) << "Incorrect value at " << index;             // NOLINT
+  }
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SampleLogTest, AreSteadySamplesCompressed) { // NOLINT
+  Data::PageEncoder encoder;
+  encoder.start(SENSOR_ID, 0, 500);
+  uint32_t timestamp = 0;
+  do {
+    timestamp += SAMPLE_PERIOD;
+  } while (encoder.append(timestamp, 500));
+  // The first sample is in the header and the second one takes 17 bits to
+  // set the one second period, every further sample takes two bits
+  const uint16_t expectedCount = 2 + ((Data::LOG_PAGE_SIZE - Data::LOG_PAGE_HEADER_SIZE) * 8 - 17) / 2;
+  EXPECT_EQ(encoder.getSampleCount(), expectedCount) << "Incorrect number of samples in a full page"; // NOLINT
+  EXPECT_EQ(encoder.getEncodedSize(), Data::LOG_PAGE_SIZE) << "Page not filled";                      // NOLINT
+  EXPECT_EQ(decodePage(encoder.finish(SEQUENCE)).size(), expectedCount) << "Samples lost";            // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SampleLogTest, AreInvalidPagesRejected) { // NOLINT
+  std::array<uint8_t, Data::LOG_PAGE_SIZE> page = {};
+  EXPECT_FALSE(Data::PageDecoder(page.data()).isValid()) << "Erased page valid";   // NOLINT
+  EXPECT_TRUE(decodePage(page.data()).empty()) << "Samples read from erased page"; // NOLINT
+
+  page[0] = Data::LOG_PAGE_MAGIC;
+  EXPECT_FALSE(Data::PageDecoder(page.data()).isValid()) << "Page of unknown version valid"; // NOLINT
+
+  // A sample count beyond the payload stops at the end of the page
+  page[1] = Data::LOG_FORMAT_VERSION;
+  page[14] = 0xFF;
+  page[15] = 0xFF;
+  EXPECT_EQ(decodePage(page.data()).size(), 961) << "Read past the end of the payload"; // NOLINT
+  std::fill(page.begin() + Data::LOG_PAGE_HEADER_SIZE, page.end(), 0xFF);
+  EXPECT_EQ(decodePage(page.data()).size(), 35) << "Read past the end of the payload"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SampleLogTest, ArePagesWrittenInCircle) { // NOLINT
+  MemoryLogStorage<PAGE_COUNT> storage;
+  Data::SampleLog sampleLog(storage);
+  ASSERT_TRUE(sampleLog.begin()) << "Log not started"; // NOLINT
+  uint32_t timestamp = 0;
+  recordPages(sampleLog, 2, timestamp);
+  EXPECT_EQ(sampleLog.getNextSlot(), 2) << "Incorrect next slot"; // NOLINT
+  recordPages(sampleLog, 2, timestamp);
+  EXPECT_EQ(sampleLog.getNextSlot(), 1) << "Slots not reused";                                             // NOLINT
+  EXPECT_EQ(Data::PageDecoder(storage.pages[0].data()).getSequence(), 4) << "Oldest page not overwritten"; // NOLINT
+
+  Data::SampleLog resumedLog(storage);
+  ASSERT_TRUE(resumedLog.begin()) << "Log not resumed";                          // NOLINT
+  EXPECT_EQ(resumedLog.getNextSlot(), 1) << "Log not resumed after newest page"; // NOLINT
+  EXPECT_EQ(resumedLog.getWrittenPages(), 4) << "Incorrect number of pages";     // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SampleLogTest, IsFlushWritingPartialPages) { // NOLINT
+  MemoryLogStorage<PAGE_COUNT> storage;
+  Data::SampleLog sampleLog(storage);
+  sampleLog.begin();
+  EXPECT_TRUE(sampleLog.record(0, 0, 10)) << "Reading not recorded";                               // NOLINT
+  EXPECT_TRUE(sampleLog.record(SENSOR_ID, 0, 20)) << "Reading not recorded";                       // NOLINT
+  EXPECT_TRUE(sampleLog.record(SENSOR_ID, SAMPLE_PERIOD, 21)) << "Reading not recorded";           // NOLINT
+  EXPECT_FALSE(sampleLog.record(Data::MAX_HISTORY_SENSORS, 0, 1)) << "Reading of unlogged sensor"; // NOLINT
+  EXPECT_TRUE(sampleLog.flush()) << "Pages not flushed";                                           // NOLINT
+  EXPECT_EQ(sampleLog.getWrittenPages(), 2) << "Incorrect number of pages";                        // NOLINT
+  EXPECT_EQ(decodePage(storage.pages[0].data()).size(), 1) << "Incorrect first page";              // NOLINT
+  EXPECT_EQ(decodePage(storage.pages[1].data()).size(), 2) << "Incorrect second page";             // NOLINT
+  EXPECT_TRUE(sampleLog.flush()) << "Empty flush failed";                                          // NOLINT
+  EXPECT_EQ(sampleLog.getWrittenPages(), 2) << "Empty pages written";                              // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SampleLogTest, AreStorageFailuresReported) { // NOLINT
+  MemoryLogStorage<PAGE_COUNT> storage;
+  storage.failing = true;
+  Data::SampleLog sampleLog(storage);
+  EXPECT_FALSE(sampleLog.begin()) << "Unavailable storage not reported"; // NOLINT
+  uint32_t timestamp = 0;
+  bool isRecorded = true;
+  while (isRecorded) {
+    isRecorded = sampleLog.record(0, timestamp, 500);
+    timestamp += SAMPLE_PERIOD;
+  }
+  EXPECT_EQ(sampleLog.getWrittenPages(), 0) << "Page written to failing storage"; // NOLINT
+  EXPECT_TRUE(sampleLog.record(0, timestamp, 500)) << "Log did not continue";     // NOLINT
+  EXPECT_FALSE(sampleLog.flush()) << "Failed flush not reported";                 // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <data/statistics/statistics.hpp>
+#include <gtest/gtest.h>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint16_t WINDOW_LENGTH = 4;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StatisticsTest, IsEwmaConvergingToStep) { // NOLINT
+  Data::Ewma ewma;
+  EXPECT_EQ(ewma.getAverage(), 0) << "Average before the first sample"; // NOLINT
+  ewma.update(100);
+  EXPECT_EQ(ewma.getAverage(), 100) << "First sample did not initialise the average"; // NOLINT
+  ewma.update(180);
+  EXPECT_EQ(ewma.getAverage(), 110) << "Incorrect average after one step"; // NOLINT
+  for (int index = 0; index < 100; ++index) {
+    ewma.update(180);
+  }
+  EXPECT_EQ(ewma.getAverage(), 180) << "Average did not converge"; // NOLINT
+  for (int index = 0; index < 100; ++index) {
+    ewma.update(-20);
+  }
+  EXPECT_EQ(ewma.getAverage(), -20) << "Average did not converge below zero"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StatisticsTest, IsRunningVarianceWorking) { // NOLINT
+  Data::RunningVariance runningVariance;
+  EXPECT_EQ(runningVariance.getVariance(), 0) << "Variance before the first sample"; // NOLINT
+  for (const int16_t value : {2, 4, 4, 4, 5, 5, 7, 9}) {
+    runningVariance.update(value);
+  }
+  EXPECT_EQ(runningVariance.getCount(), 8) << "Incorrect number of samples"; // NOLINT
+  EXPECT_EQ(runningVariance.getMean(), 5) << "Incorrect mean";               // NOLINT
+  EXPECT_EQ(runningVariance.getVariance(), 4) << "Incorrect variance";       // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StatisticsTest, IsRunningVarianceWorkingForAdcRange) { // NOLINT
+  Data::RunningVariance runningVariance;
+  for (int index = 0; index < 1000; ++index) {
+    runningVariance.update(static_cast<int16_t>(index % 2 == 0 ? 0 : 1000));
+  }
+  EXPECT_EQ(runningVariance.getMean(), 500) << "Incorrect mean";                   // NOLINT
+  EXPECT_NEAR(runningVariance.getVariance(), 250000, 500) << "Incorrect variance"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StatisticsTest, IsRunningMeanFollowingStepAfterManySamples) { // NOLINT
+  Data::RunningVariance runningVariance;
+  const int sampleCount = 200000;
+  for (int index = 0; index < sampleCount; ++index) {
+    runningVariance.update(static_cast<int16_t>(index < sampleCount / 2 ? 100 : 200));
+  }
+  EXPECT_EQ(runningVariance.getCount(), sampleCount) << "Incorrect number of samples"; // NOLINT
+  EXPECT_EQ(runningVariance.getMean(), 150) << "Mean must follow the step";            // NOLINT
+  EXPECT_NEAR(runningVariance.getVariance(), 2500, 1) << "Incorrect variance";         // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StatisticsTest, AreMovingExtremesTrackingWindow) { // NOLINT
+  Data::MovingExtremes<WINDOW_LENGTH> extremes;
+  EXPECT_EQ(extremes.getMinimum(), 0) << "Minimum before the first sample"; // NOLINT
+  EXPECT_EQ(extremes.getMaximum(), 0) << "Maximum before the first sample"; // NOLINT
+  const int16_t values[] = {5, 1, 9, 3, 4, 6, 2, 8, 8, 7};
+  const int16_t minimums[] = {5, 1, 1, 1, 1, 3, 2, 2, 2, 2};
+  const int16_t maximums[] = {5, 5, 9, 9, 9, 9, 6, 8, 8, 8};
+  for (size_t index = 0; index < sizeof(values) / sizeof(values[0]); ++index) {
+    extremes.update(values[index]);
+    EXPECT_EQ(extremes.getMinimum(), minimums[index]) << "Incorrect minimum at sample " << index; // NOLINT
+    EXPECT_EQ(extremes.getMaximum(), maximums[index]) << "Incorrect maximum at sample " << index; // NOLINT
+  }
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StatisticsTest, AreSensorStatisticsUpdated) { // NOLINT
+  Data::SensorStatistics statistics;
+  statistics.update(10);
+  statistics.update(30);
+  EXPECT_EQ(statistics.getCount(), 2) << "Incorrect number of readings"; // NOLINT
+  EXPECT_EQ(statistics.getEwma(), 13) << "Incorrect moving average";     // NOLINT
+  EXPECT_EQ(statistics.getMean(), 20) << "Incorrect mean";               // NOLINT
+  EXPECT_EQ(statistics.getVariance(), 100) << "Incorrect variance";      // NOLINT
+  EXPECT_EQ(statistics.getMinimum(), 10) << "Incorrect minimum";         // NOLINT
+  EXPECT_EQ(statistics.getMaximum(), 30) << "Incorrect maximum";         // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -38,6 +38,8 @@
 #include <executor/executor.hpp>
 #include <gmock/gmock.h>
 #include <memory>
+#include <sensors/edge-sensor/edge-sensor.hpp>
+#include <timing/virtual-clock/virtual-clock.hpp>
 
 #ifdef NATIVE
 namespace {
@@ -45,29 +47,194 @@ using namespace fakeit; // NOLINT(google-build-using-namespace)
 using ::testing::Exactly;
 
 // cppcheck-suppress [syntaxError,unmatchedSuppression]
-TEST(ExecutorTest, IsLoopWorking) {          // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
+TEST(ExecutorTest, IsLoopWorking) { // NOLINT
+  Sensors::SensorSet<1> sensors;
   When(Method(ArduinoFake(), delay)).AlwaysReturn();
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(0);
   MockReadSensors mockReadSensors(sensors);
   MockSystemState mockState(mockReadSensors);
   MockSystemController mockController(mockState);
   MockSystemProcess mockSystemProcess(mockController, mockState);
-  MockDataProcess mockDataProcess;
+  MockDataProcess mockDataProcess(mockReadSensors);
   MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess);
   EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(1));
   EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(1));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(1));
   executor.loop();
-  Verify(Method(ArduinoFake(), delay).Using(MainExecutor::DELAY)).Once();
+  Verify(Method(ArduinoFake(), delay)).Never();
 }
 
-TEST(ExecutorTest, IsSetupWorking) {         // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
+TEST(ExecutorTest, IsLoopReturningWhenNothingIsDue) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(MainExecutor::READ_SENSORS_PERIOD - 1);
+  MockReadSensors mockReadSensors(sensors);
+  MockSystemState mockState(mockReadSensors);
+  MockSystemController mockController(mockState);
+  MockSystemProcess mockSystemProcess(mockController, mockState);
+  MockDataProcess mockDataProcess(mockReadSensors);
+  MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess);
+  EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(1));
+  EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(1));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(1));
+  executor.loop();
+  executor.loop();
+}
+
+TEST(ExecutorTest, IsLoopRunningTasksOnTheirPeriods) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  unsigned long currentMillis = 0;
+  When(Method(ArduinoFake(), millis)).AlwaysDo([&currentMillis]() -> unsigned long { return currentMillis; });
+  MockReadSensors mockReadSensors(sensors);
+  MockSystemState mockState(mockReadSensors);
+  MockSystemController mockController(mockState);
+  MockSystemProcess mockSystemProcess(mockController, mockState);
+  MockDataProcess mockDataProcess(mockReadSensors);
+  MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess);
+  const auto loopCount = MainExecutor::DATA_PROCESS_PERIOD / MainExecutor::READ_SENSORS_PERIOD;
+  EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(loopCount + 1));
+  EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(loopCount + 1));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(2));
+  for (unsigned int i = 0; i <= loopCount; ++i) {
+    currentMillis = i * MainExecutor::READ_SENSORS_PERIOD;
+    executor.loop();
+  }
+}
+
+TEST(ExecutorTest, IsRunningTasksDueAtTheGivenTime) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  MockReadSensors mockReadSensors(sensors);
+  MockSystemState mockState(mockReadSensors);
+  MockSystemController mockController(mockState);
+  MockSystemProcess mockSystemProcess(mockController, mockState);
+  MockDataProcess mockDataProcess(mockReadSensors);
+  MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess);
+  EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(2));
+  EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(2));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(1));
+  EXPECT_EQ(executor.timeUntilNextTask(0), 0) << "All tasks must be due at start"; // NOLINT
+  executor.runDueTasks(0);
+  const auto period = MainExecutor::READ_SENSORS_PERIOD;
+  EXPECT_EQ(executor.timeUntilNextTask(0), period) << "Next read must be one period away"; // NOLINT
+  EXPECT_EQ(executor.timeUntilNextTask(period - 1), 1) << "Wait must shrink with time";    // NOLINT
+  executor.runDueTasks(period);
+}
+
+TEST(ExecutorTest, IsRunningReadAndSystemProcessOnLatchedEdges) { // NOLINT
+  ArduinoFakeReset();
+  void (*pinChangeHandler)() = nullptr;
+  When(Method(ArduinoFake(), attachInterrupt)).AlwaysDo([&pinChangeHandler](uint8_t, void (*handler)(), int) {
+    pinChangeHandler = handler;
+  });
+  When(Method(ArduinoFake(), detachInterrupt)).AlwaysReturn();
+  When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(LOW);
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(1);
+  Sensors::EdgeSensor floatSwitch("Float Switch", 2, HIGH);
+  floatSwitch.begin();
+  Sensors::SensorSet<1> sensors = {&floatSwitch};
+  MockReadSensors mockReadSensors(sensors);
+  MockSystemState mockState(mockReadSensors);
+  MockSystemController mockController(mockState);
+  MockSystemProcess mockSystemProcess(mockController, mockState);
+  MockDataProcess mockDataProcess(mockReadSensors);
+  MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess);
+  EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(2));
+  EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(2));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(1));
+  executor.runDueTasks(0);
+  executor.runDueTasks(1);
+  When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(HIGH);
+  pinChangeHandler();
+  executor.runDueTasks(1);
+  EXPECT_EQ(executor.getStageTimes(MainExecutor::READ_SENSORS_TASK).getCount(), 2) // NOLINT
+      << "Edge triggered read not timed";
+}
+
+TEST(ExecutorTest, IsJumpingToTheNextTaskOnVirtualClock) { // NOLINT
+  ArduinoFakeReset();
+  Sensors::SensorSet<1> sensors;
+  Timing::VirtualClock clock;
+  MockReadSensors mockReadSensors(sensors);
+  MockSystemState mockState(mockReadSensors);
+  MockSystemController mockController(mockState);
+  MockSystemProcess mockSystemProcess(mockController, mockState);
+  MockDataProcess mockDataProcess(mockReadSensors);
+  MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess, clock);
+  const uint32_t hour = 3600000;
+  const uint32_t loopCount = hour / MainExecutor::READ_SENSORS_PERIOD;
+  EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(loopCount));
+  EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(loopCount));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(hour / MainExecutor::DATA_PROCESS_PERIOD));
+  while (clock.millis() < hour) {
+    executor.loop();
+    executor.waitForNextTask();
+  }
+  EXPECT_EQ(clock.millis(), hour) << "Clock must stop at the last deadline"; // NOLINT
+  Verify(Method(ArduinoFake(), millis)).Never();
+  Verify(Method(ArduinoFake(), delay)).Never();
+}
+
+TEST(ExecutorTest, IsTimingEveryStage) { // NOLINT
+  ArduinoFakeReset();
+  When(OverloadedMethod(ArduinoFake(Serial), println, size_t(const char *))).AlwaysReturn(0);
+  Sensors::SensorSet<1> sensors;
+  Timing::VirtualClock clock;
+  MockReadSensors mockReadSensors(sensors);
+  MockSystemState mockState(mockReadSensors);
+  MockSystemController mockController(mockState);
+  MockSystemProcess mockSystemProcess(mockController, mockState);
+  MockDataProcess mockDataProcess(mockReadSensors);
+  MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess, clock);
+  EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(2));
+  EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(2));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(1));
+  executor.loop();
+  clock.advance(MainExecutor::READ_SENSORS_PERIOD);
+  executor.loop();
+  const auto &readTimes = executor.getStageTimes(MainExecutor::READ_SENSORS_TASK);
+  const auto &passTimes = executor.getStageTimes(MainExecutor::SYSTEM_PROCESS_TASK);
+  const auto &dataTimes = executor.getStageTimes(MainExecutor::DATA_PROCESS_TASK);
+  EXPECT_EQ(readTimes.getCount(), 2) << "Reads must be timed";  // NOLINT
+  EXPECT_EQ(passTimes.getCount(), 2) << "Passes must be timed"; // NOLINT
+  EXPECT_EQ(dataTimes.getCount(), 1) << "Data must be timed";   // NOLINT
+
+  executor.printStageTimes();
+  Verify(OverloadedMethod(ArduinoFake(Serial), println, size_t(const char *))).Exactly(MainExecutor::TASK_COUNT);
+  EXPECT_EQ(readTimes.getCount(), 0) << "Printing must reset"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ExecutorTest, IsCallingStagesByStaticType) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  Timing::VirtualClock clock;
+  MockReadSensors mockReadSensors(sensors);
+  MockSystemState mockState(mockReadSensors);
+  MockSystemController mockController(mockState);
+  MockSystemProcess mockSystemProcess(mockController, mockState);
+  MockDataProcess mockDataProcess(mockReadSensors);
+  MainExecutor::BasicExecutor<MockReadSensors, MockSystemProcess, MockDataProcess, Timing::VirtualClock> executor(
+      mockReadSensors, mockSystemProcess, mockDataProcess, clock);
+  EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(2));
+  EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(2));
+  EXPECT_CALL(mockDataProcess, run()).Times(Exactly(1));
+  executor.loop();
+  executor.waitForNextTask();
+  executor.loop();
+  EXPECT_EQ(clock.millis(), MainExecutor::READ_SENSORS_PERIOD) << "Clock must jump to the next task"; // NOLINT
+  EXPECT_EQ(executor.getStageTimes(MainExecutor::READ_SENSORS_TASK).getCount(), 2)                    // NOLINT
+      << "Read stage not timed";
+  executor.resetStageTimes();
+  EXPECT_EQ(executor.getStageTimes(MainExecutor::READ_SENSORS_TASK).getCount(), 0) // NOLINT
+      << "Stage times not reset";
+}
+
+TEST(ExecutorTest, IsSetupWorking) { // NOLINT
+  Sensors::SensorSet<1> sensors;
   When(OverloadedMethod(ArduinoFake(Serial), begin, void(unsigned long))).AlwaysReturn();
   MockReadSensors mockReadSensors(sensors);
   MockSystemState mockState(mockReadSensors);
   MockSystemController mockController(mockState);
   MockSystemProcess mockSystemProcess(mockController, mockState);
-  MockDataProcess mockDataProcess;
+  MockDataProcess mockDataProcess(mockReadSensors);
   MainExecutor::Executor executor(mockReadSensors, mockSystemProcess, mockDataProcess);
   EXPECT_CALL(mockReadSensors, readAllSensors()).Times(Exactly(0));
   EXPECT_CALL(mockSystemProcess, run()).Times(Exactly(0));
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <executor/scheduler/scheduler.hpp>
+#include <gtest/gtest.h>
+
+#ifdef NATIVE
+
+namespace {
+const uint8_t FIRST_TASK = 0;
+const uint8_t SECOND_TASK = 1;
+const uint32_t PERIOD = 100;
+const uint32_t ROLLOVER_MILLIS = 0xFFFFFFF0;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SchedulerTest, IsAddTaskWorking) { // NOLINT
+  MainExecutor::Scheduler scheduler;
+  EXPECT_TRUE(scheduler.addTask(FIRST_TASK, PERIOD, 0)) << "Task was not added";   // NOLINT
+  EXPECT_FALSE(scheduler.addTask(SECOND_TASK, 0, 0)) << "Task without period added"; // NOLINT
+  EXPECT_EQ(scheduler.getTaskCount(), 1) << "Wrong number of tasks";                 // NOLINT
+}
+
+TEST(SchedulerTest, IsAddTaskRejectedWhenFull) { // NOLINT
+  MainExecutor::Scheduler scheduler;
+  for (uint8_t id = 0; id < MainExecutor::MAX_TASKS; ++id) {
+    EXPECT_TRUE(scheduler.addTask(id, PERIOD, id)) << "Task was not added"; // NOLINT
+  }
+  EXPECT_FALSE(scheduler.addTask(MainExecutor::MAX_TASKS, PERIOD, 0)) << "Task added to a full scheduler"; // NOLINT
+  EXPECT_EQ(scheduler.getTaskCount(), MainExecutor::MAX_TASKS) << "Wrong number of tasks";                  // NOLINT
+}
+
+TEST(SchedulerTest, NoTaskDueWhenEmpty) { // NOLINT
+  MainExecutor::Scheduler scheduler;
+  uint8_t id = 0;
+  EXPECT_FALSE(scheduler.nextDueTask(0, id)) << "Empty scheduler returned a task";         // NOLINT
+  EXPECT_EQ(scheduler.timeUntilNextTask(0), 0) << "Wrong time until next task when empty"; // NOLINT
+}
+
+TEST(SchedulerTest, IsTaskDueOnlyAtDeadline) { // NOLINT
+  MainExecutor::Scheduler scheduler;
+  uint8_t id = SECOND_TASK;
+  scheduler.addTask(FIRST_TASK, PERIOD, PERIOD);
+  EXPECT_FALSE(scheduler.nextDueTask(PERIOD - 1, id)) << "Task returned before its deadline"; // NOLINT
+  EXPECT_EQ(scheduler.timeUntilNextTask(PERIOD - 1), 1) << "Wrong time until next task";      // NOLINT
+  EXPECT_TRUE(scheduler.nextDueTask(PERIOD, id)) << "Task not returned at its deadline";      // NOLINT
+  EXPECT_EQ(id, FIRST_TASK) << "Wrong task returned";                                         // NOLINT
+  EXPECT_FALSE(scheduler.nextDueTask(PERIOD, id)) << "Task returned twice for one deadline";  // NOLINT
+  EXPECT_EQ(scheduler.timeUntilNextTask(PERIOD), PERIOD) << "Task not rescheduled by period"; // NOLINT
+}
+
+TEST(SchedulerTest, AreTasksReturnedInDeadlineOrder) { // NOLINT
+  MainExecutor::Scheduler scheduler;
+  uint8_t id = 0;
+  const uint8_t lateTask = 2;
+  scheduler.addTask(lateTask, PERIOD, 2);
+  scheduler.addTask(SECOND_TASK, PERIOD, 1);
+  scheduler.addTask(FIRST_TASK, PERIOD, 1);
+  EXPECT_TRUE(scheduler.nextDueTask(2, id));
+  EXPECT_EQ(id, FIRST_TASK) << "Tasks with the same deadline not run in identifier order"; // NOLINT
+  EXPECT_TRUE(scheduler.nextDueTask(2, id));
+  EXPECT_EQ(id, SECOND_TASK) << "Tasks with the same deadline not run in identifier order"; // NOLINT
+  EXPECT_TRUE(scheduler.nextDueTask(2, id));
+  EXPECT_EQ(id, lateTask) << "Task with the later deadline not run last"; // NOLINT
+  EXPECT_FALSE(scheduler.nextDueTask(2, id)) << "Task returned before its next deadline"; // NOLINT
+}
+
+TEST(SchedulerTest, AreMissedRunsSkipped) { // NOLINT
+  MainExecutor::Scheduler scheduler;
+  uint8_t id = 0;
+  const uint32_t lateMillis = 5 * PERIOD + 1;
+  scheduler.addTask(FIRST_TASK, PERIOD, 0);
+  EXPECT_TRUE(scheduler.nextDueTask(lateMillis, id));
+  EXPECT_FALSE(scheduler.nextDueTask(lateMillis, id)) << "Missed runs were not skipped";           // NOLINT
+  EXPECT_EQ(scheduler.timeUntilNextTask(lateMillis), PERIOD) << "Task not rescheduled from now"; // NOLINT
+}
+
+TEST(SchedulerTest, IsMillisRolloverHandled) { // NOLINT
+  MainExecutor::Scheduler scheduler;
+  uint8_t id = 0;
+  scheduler.addTask(FIRST_TASK, PERIOD, ROLLOVER_MILLIS);
+  EXPECT_TRUE(scheduler.nextDueTask(ROLLOVER_MILLIS, id));
+  EXPECT_FALSE(scheduler.nextDueTask(0, id)) << "Task returned early after rollover"; // NOLINT
+  EXPECT_EQ(scheduler.timeUntilNextTask(0), PERIOD - (0 - ROLLOVER_MILLIS))
+      << "Wrong time until next task after rollover"; // NOLINT
+  EXPECT_TRUE(scheduler.nextDueTask(ROLLOVER_MILLIS + PERIOD, id)) << "Task not returned after rollover"; // NOLINT
+}
+
+} // namespace
+#endif
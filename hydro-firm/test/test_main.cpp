@@ -29,14 +29,7 @@
  */
 
 #include "main.cpp" //NOLINT(bugprone-suspicious-include)
-#include "test_data/test_process/mock-process.hpp"
-#include "test_executor/mock-executor.hpp"
-#include "test_sensors/mock-sensors.hpp"
-#include "test_sensors/test_read-sensors/mock-read-sensors.hpp"
-#include "test_system/test_controller/mock-controller.hpp"
-#include "test_system/test_state/mock-state.hpp"
 #include <gmock/gmock.h>
-#include <memory>
 
 #ifdef ARDUINO
 #include <Arduino.h>
@@ -65,21 +58,6 @@ void loop() {
 
 #else
 
-using ::testing::Exactly;
-
-TEST(MainTest, TestLoopAndSetup) {           // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
-  MockReadSensors mockReadSensors(sensors);
-  MockSystemState mockState(mockReadSensors);
-  MockSystemController mockController(mockState);
-  MockSystemProcess mockSystemProcess(mockController, mockState);
-  MockDataProcess mockDataProcess;
-  MockExecutor executor(mockReadSensors, mockSystemProcess, mockDataProcess);
-  EXPECT_CALL(executor, loop()).Times(Exactly(1));
-  EXPECT_CALL(executor, setup()).Times(Exactly(1));
-  run(executor, 1);
-}
-
 auto main(int argc, char **argv) -> int {
   ::testing::InitGoogleMock(&argc, argv);
   RUN_ALL_TESTS();
@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../../allocation-tracker.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef NATIVE
+namespace {
+
+const size_t ELEMENT_COUNT = 16;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(AllocationTrackerTest, IsCountingAllocationsAndBytes) { // NOLINT
+  AllocationTracker::Scope scope;
+  EXPECT_EQ(scope.getAllocations(), 0) << "A new scope must count nothing";                     // NOLINT
+  std::unique_ptr<uint32_t[]> values(new uint32_t[ELEMENT_COUNT]);                              // NOLINT
+  EXPECT_EQ(scope.getAllocations(), 1) << "The array must be counted";                          // NOLINT
+  EXPECT_EQ(scope.getBytes(), ELEMENT_COUNT * sizeof(uint32_t)) << "Its bytes must be counted"; // NOLINT
+  scope.restart();
+  values.reset();
+  EXPECT_EQ(scope.getAllocations(), 0) << "Freeing must not count";                           // NOLINT
+}
+
+TEST(AllocationTrackerTest, IsCountingOneCall) { // NOLINT
+  std::vector<uint8_t> buffer;
+  const AllocationTracker::AllocationCount growth =
+      AllocationTracker::count([&buffer]() { buffer.reserve(ELEMENT_COUNT); });
+  EXPECT_EQ(growth.allocations, 1) << "Reserving must allocate once";    // NOLINT
+  EXPECT_EQ(growth.bytes, ELEMENT_COUNT) << "Reserved bytes must count"; // NOLINT
+  EXPECT_NO_ALLOCATIONS(buffer.push_back(1));
+  EXPECT_ALLOCATIONS(1, std::unique_ptr<int> value(new int(1)));
+}
+
+TEST(AllocationTrackerTest, IsCountingFromTestStart) { // NOLINT
+  const AllocationTracker::AllocationCount before = AllocationTracker::getTestTotal();
+  const std::unique_ptr<int> value(new int(1));
+  EXPECT_EQ(AllocationTracker::getTestTotal().allocations, before.allocations + 1) << "Test total must grow"; // NOLINT
+  EXPECT_LT(AllocationTracker::getTestTotal().allocations, AllocationTracker::getTotal().allocations)         // NOLINT
+      << "Allocations before the test must not count";                                                        // NOLINT
+}
+
+TEST(AllocationTrackerTest, IsCapturingTheStack) { // NOLINT
+  ::testing::internal::CaptureStderr();
+  {
+    const AllocationTracker::StackCapture capture;
+    EXPECT_ALLOCATIONS(1, std::unique_ptr<int> value(new int(1)));
+  }
+  const std::unique_ptr<int> uncaptured(new int(1));
+  const std::string output = ::testing::internal::GetCapturedStderr();
+  EXPECT_NE(output.find("Allocation of"), std::string::npos) << "The allocation must be printed"; // NOLINT
+  EXPECT_EQ(output.find("Allocation of"), output.rfind("Allocation of"))                          // NOLINT
+      << "Only the allocation made during the capture must be printed";                           // NOLINT
+}
+} // namespace
+#endif
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <ArduinoFake.h>
+#include <memory/footprint/footprint.hpp>
+
+#ifdef NATIVE
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+
+const size_t BUFFER_SIZE = 100;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(FootprintReportTest, IsSummingListedSizes) { // NOLINT
+  const std::array<uint8_t, BUFFER_SIZE> buffer = {};
+  const uint32_t counter = 0;
+  Memory::FootprintReport report;
+  EXPECT_EQ(report.getTotal(), 0) << "An empty report must total zero";               // NOLINT
+  EXPECT_TRUE(report.addObject("buffer", buffer)) << "The buffer must be listed";     // NOLINT
+  EXPECT_TRUE(report.addObject("counter", counter)) << "The counter must be listed";  // NOLINT
+  EXPECT_EQ(report.getEntryCount(), 2) << "Both objects must be listed";              // NOLINT
+  EXPECT_EQ(report.getTotal(), BUFFER_SIZE + sizeof(counter)) << "Sizes must add up"; // NOLINT
+}
+
+TEST(FootprintReportTest, IsBounded) { // NOLINT
+  Memory::FootprintReport report;
+  for (uint8_t index = 0; index < Memory::MAX_FOOTPRINT_ENTRIES; ++index) {
+    EXPECT_TRUE(report.add("entry", 1)) << "Entries up to the limit must be listed"; // NOLINT
+  }
+  EXPECT_FALSE(report.add("entry", 1)) << "Entries past the limit must be refused";              // NOLINT
+  EXPECT_EQ(report.getTotal(), Memory::MAX_FOOTPRINT_ENTRIES) << "Refused entry must not count"; // NOLINT
+}
+
+TEST(FootprintReportTest, IsPrintingEntriesAndTotal) { // NOLINT
+  ArduinoFakeReset();
+  When(OverloadedMethod(ArduinoFake(Serial), println, size_t(const char *))).AlwaysReturn(0);
+  Memory::FootprintReport report;
+  report.add("first", 1);
+  report.add("second", 2);
+  report.print();
+  Verify(OverloadedMethod(ArduinoFake(Serial), println, size_t(const char *))).Exactly(3);
+}
+} // namespace
+#endif
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../../allocation-tracker.hpp"
+#include "../../test_data/memory-log-storage.hpp"
+#include "../../test_sensors/fixed-sensor.hpp"
+#include <ArduinoFake.h>
+#include <data/process/process.hpp>
+#include <data/sample-log/sample-log.hpp>
+#include <executor/executor.hpp>
+#include <sensors/moisture-level/moisture-level.hpp>
+#include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/sensor-set/sensor-set.hpp>
+#include <sensors/water-level/water-level.hpp>
+#include <system/process/process.hpp>
+#include <timing/virtual-clock/virtual-clock.hpp>
+
+#ifdef NATIVE
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+
+const uint32_t PAGE_COUNT = 4;
+// Long enough for the sample log to fill and wrap around its pages
+const uint32_t LOOP_COUNT = 20000;
+const int READING_RANGE = 1024;
+
+/*
+ * A complete node, set up as at boot
+ */
+class HeapFreeLoopTest : public ::testing::Test {
+protected:
+  Timing::VirtualClock clock;
+  FixedSensor waterLevelSensor{Sensors::WATER_LEVEL_SENSOR};
+  FixedSensor moistureLevelSensor{Sensors::MOISTURE_LEVEL_SENSOR};
+  Sensors::SensorSet<2> sensors = {&waterLevelSensor, &moistureLevelSensor};
+  Sensors::ReadSensors readSensors{sensors, Sensors::BATCHED, clock};
+  System::State state{readSensors};
+  System::Controller controller{state};
+  System::Process systemProcess{controller, state};
+  MemoryLogStorage<PAGE_COUNT> logStorage;
+  Data::SampleLog sampleLog{logStorage};
+  Data::Process dataProcess{readSensors, clock};
+  MainExecutor::Executor executor{readSensors, systemProcess, dataProcess, clock};
+
+  void SetUp() override {
+    ArduinoFakeReset();
+    When(OverloadedMethod(ArduinoFake(Serial), begin, void(unsigned long))).AlwaysReturn();
+    this->sampleLog.begin();
+    this->dataProcess.addSampleSink(this->sampleLog);
+    this->executor.setup();
+    this->executor.loop();
+  }
+
+  /*
+   * Set readings sweeping the whole range, which drive the system through its
+   * modes
+   */
+  void step(const uint32_t loop) {
+    this->waterLevelSensor.value = static_cast<int>(loop % READING_RANGE);
+    this->moistureLevelSensor.value = static_cast<int>((loop * 7) % READING_RANGE);
+    this->clock.advance(MainExecutor::READ_SENSORS_PERIOD);
+  }
+};
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(HeapFreeLoopTest, IsLoopFreeOfAllocations) { // NOLINT
+  const AllocationTracker::Scope scope;
+  for (uint32_t loop = 0; loop < LOOP_COUNT; ++loop) {
+    this->step(loop);
+    this->executor.loop();
+  }
+  EXPECT_EQ(scope.getAllocations(), 0) << "The loop must not allocate after boot";          // NOLINT
+  EXPECT_GT(this->logStorage.writeCount, PAGE_COUNT) << "The sample log must have wrapped"; // NOLINT
+}
+
+TEST_F(HeapFreeLoopTest, IsEveryLoopIterationFreeOfAllocations) { // NOLINT
+  for (uint32_t loop = 0; loop < READING_RANGE; ++loop) {
+    this->step(loop);
+    const AllocationTracker::AllocationCount cycle = AllocationTracker::count([this]() { this->executor.loop(); });
+    ASSERT_EQ(cycle.allocations, 0) << "Loop " << loop << " allocated " << cycle.bytes << " bytes"; // NOLINT
+  }
+}
+
+TEST_F(HeapFreeLoopTest, IsEveryStageFreeOfAllocations) { // NOLINT
+  for (uint32_t loop = 0; loop < READING_RANGE; ++loop) {
+    this->step(loop);
+    EXPECT_NO_ALLOCATIONS(this->readSensors.readAllSensors());
+    EXPECT_NO_ALLOCATIONS(this->state.isWaterLevelMax());
+    EXPECT_NO_ALLOCATIONS(this->state.isWaterLevelMin());
+    EXPECT_NO_ALLOCATIONS(this->state.isMoistureLevelMin());
+    EXPECT_NO_ALLOCATIONS(this->systemProcess.run());
+    EXPECT_NO_ALLOCATIONS(this->dataProcess.run());
+  }
+}
+} // namespace
+#endif
@@ -0,0 +1,52 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#ifndef TEST_SENSORS_FIXED_SENSOR_HPP
+#define TEST_SENSORS_FIXED_SENSOR_HPP
+
+#include <sensors/sensor.hpp>
+
+/*
+ * Sensor without a power pin returning a reading set by the test, so neither
+ * the pins nor the cost of the fake Arduino core show up in the results
+ */
+class FixedSensor final : public Sensors::Sensor {
+public:
+  int value;
+
+  explicit FixedSensor(const char *type, const int value = 0, const uint8_t readPin = 0)
+      : Sensors::Sensor(type, Sensors::ANALOG, readPin), value(value) {}
+
+  void sampleSensor() override {}
+
+  auto getReading() const -> int override { return this->value; }
+};
+
+#endif
@@ -32,7 +32,6 @@
 #define TEST_SENSORS_TEST_SENSORS_HPP
 
 #include <gmock/gmock.h>
-#include <string>
 
 #include <sensors/sensor.hpp>
 
@@ -41,18 +40,26 @@ class MockSensor : public Sensors::Sensor // NOLINT(cppcoreguidelines-avoid-non-
 
 public:
   // NOLINTNEXTLINE
-  MockSensor(const std::string &sensorType, const uint8_t readPin, const uint8_t powerPin)
+  MockSensor(const char *sensorType, const uint8_t readPin, const uint8_t powerPin)
       : Sensors::Sensor(sensorType, Sensors::ANALOG, readPin, powerPin) {}
   // NOLINTNEXTLINE
+  MockSensor(const char *sensorType, const uint8_t readPin, const uint8_t powerPin, const int16_t readDelay)
+      : Sensors::Sensor(sensorType, Sensors::ANALOG, readPin, powerPin, readDelay) {}
+  // NOLINTNEXTLINE
+  MockSensor(const char *sensorType, const uint8_t readPin)
+      : Sensors::Sensor(sensorType, Sensors::ANALOG, readPin) {}
+  // NOLINTNEXTLINE
   MOCK_METHOD(void, readSensor, (), (override));
   // NOLINTNEXTLINE
+  MOCK_METHOD(void, sampleSensor, (), (override));
+  // NOLINTNEXTLINE
   MOCK_METHOD(void, initSensor, (), (override));
   // NOLINTNEXTLINE
   MOCK_METHOD(void, resetSensor, (), (override));
   // NOLINTNEXTLINE
   MOCK_METHOD(int, getReading, (), (const, override));
   // NOLINTNEXTLINE
-  MOCK_METHOD(std::string, getType, (), (override));
+  MOCK_METHOD(const char *, getType, (), (override));
 };
 
 #endif
\ No newline at end of file
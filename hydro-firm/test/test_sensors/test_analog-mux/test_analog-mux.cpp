@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../mock-sensors.hpp"
+#include <ArduinoFake.h>
+#include <array>
+#include <gmock/gmock.h>
+#include <list>
+#include <memory>
+#include <sensors/analog-mux/analog-mux.hpp>
+#include <timing/virtual-clock/virtual-clock.hpp>
+#include <vector>
+
+#ifdef NATIVE
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+using ::testing::Exactly;
+
+auto const ADC_PIN = A0;
+auto const POWER_PIN = 2;
+auto const SECOND_POWER_PIN = 3;
+auto const SHORT_READ_DELAY = 10;
+auto const LONG_READ_DELAY = 40;
+auto const SETTLE_MICROS = 5;
+const std::array<uint8_t, Sensors::MUX_SELECT_LINES> SELECT_PINS = {12, 13, 14, 15};
+const char *const SENSOR_TYPE = "Mux Sensor";
+
+/*
+ * Stub the pins driven by the multiplexer
+ */
+void stubMuxPins() {
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), pinMode)).AlwaysReturn();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), delayMicroseconds)).AlwaysReturn();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(AnalogMuxTest, IsSelectingFirstChannelOnBegin) { // NOLINT
+  stubMuxPins();
+  Sensors::AnalogMux mux(SELECT_PINS);
+  mux.begin();
+  for (auto selectPin : SELECT_PINS) {
+    Verify(Method(ArduinoFake(), pinMode).Using(selectPin, OUTPUT)).Once();
+    Verify(Method(ArduinoFake(), digitalWrite).Using(selectPin, LOW)).Once();
+  }
+  EXPECT_EQ(mux.getSelectedChannel(), 0) << "First channel must be selected"; // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(AnalogMuxTest, IsBindingEachChannelOnce) { // NOLINT
+  MockSensor firstSensor(SENSOR_TYPE, ADC_PIN);
+  MockSensor secondSensor(SENSOR_TYPE, ADC_PIN);
+  Sensors::AnalogMux mux(SELECT_PINS);
+  EXPECT_EQ(firstSensor.getMuxChannel(), Sensors::NO_MUX_CHANNEL) << "Sensor bound before adding";  // NOLINT
+  EXPECT_TRUE(mux.addSensor(firstSensor, 3)) << "Free channel not bound";                           // NOLINT
+  EXPECT_EQ(firstSensor.getMuxChannel(), 3) << "Channel not assigned to the sensor";                // NOLINT
+  EXPECT_FALSE(mux.addSensor(secondSensor, 3)) << "Channel bound twice";                            // NOLINT
+  EXPECT_FALSE(mux.addSensor(secondSensor, Sensors::MUX_CHANNELS)) << "Channel out of range bound"; // NOLINT
+  EXPECT_EQ(secondSensor.getMuxChannel(), Sensors::NO_MUX_CHANNEL) << "Rejected sensor was bound";  // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(AnalogMuxTest, IsScanningInGrayCodeOrder) { // NOLINT
+  stubMuxPins();
+  Sensors::AnalogMux mux(SELECT_PINS, SETTLE_MICROS);
+  mux.begin();
+  ArduinoFake().ClearInvocationHistory();
+  std::vector<uint8_t> visited;
+  std::list<std::unique_ptr<MockSensor>> sensors;
+  for (uint8_t channel = 0; channel < Sensors::MUX_CHANNELS; ++channel) {
+    sensors.emplace_back(new MockSensor(SENSOR_TYPE, ADC_PIN));
+    mux.addSensor(*sensors.back(), channel);
+    EXPECT_CALL(*sensors.back(), sampleSensor()).Times(Exactly(2)).WillRepeatedly([&mux, &visited]() {
+      visited.push_back(mux.getSelectedChannel());
+    });
+  }
+
+  mux.scan();
+  for (uint8_t step = 0; step < Sensors::MUX_CHANNELS; ++step) {
+    EXPECT_EQ(visited[step], Sensors::grayCode(step)) << "Forward scan out of Gray code order"; // NOLINT
+  }
+  Verify(Method(ArduinoFake(), digitalWrite)).Exactly(Sensors::MUX_CHANNELS - 1);
+  Verify(Method(ArduinoFake(), delayMicroseconds).Using(SETTLE_MICROS)).Exactly(Sensors::MUX_CHANNELS);
+
+  mux.scan();
+  for (uint8_t step = 0; step < Sensors::MUX_CHANNELS; ++step) {
+    EXPECT_EQ(visited[Sensors::MUX_CHANNELS + step], Sensors::grayCode(Sensors::MUX_CHANNELS - 1 - step)) // NOLINT
+        << "Backward scan out of Gray code order";
+  }
+  Verify(Method(ArduinoFake(), digitalWrite)).Exactly(2 * (Sensors::MUX_CHANNELS - 1));
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(AnalogMuxTest, IsSkippingUnboundChannels) { // NOLINT
+  stubMuxPins();
+  Sensors::AnalogMux mux(SELECT_PINS, SETTLE_MICROS);
+  mux.begin();
+  ArduinoFake().ClearInvocationHistory();
+  MockSensor firstSensor(SENSOR_TYPE, ADC_PIN);
+  MockSensor secondSensor(SENSOR_TYPE, ADC_PIN);
+  mux.addSensor(firstSensor, 0);
+  mux.addSensor(secondSensor, 3);
+  EXPECT_CALL(firstSensor, sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(secondSensor, sampleSensor()).Times(Exactly(1));
+  mux.scan();
+  EXPECT_EQ(mux.getSelectedChannel(), 3) << "Scan must end on the last bound channel"; // NOLINT
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SELECT_PINS[0], HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SELECT_PINS[1], HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite)).Twice();
+  Verify(Method(ArduinoFake(), delayMicroseconds)).Twice();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(AnalogMuxTest, IsSharingOneReadDelay) { // NOLINT
+  stubMuxPins();
+  Timing::VirtualClock clock;
+  Sensors::AnalogMux mux(SELECT_PINS);
+  mux.setClock(clock);
+  MockSensor firstSensor(SENSOR_TYPE, ADC_PIN, POWER_PIN, SHORT_READ_DELAY);
+  MockSensor secondSensor(SENSOR_TYPE, ADC_PIN, SECOND_POWER_PIN, LONG_READ_DELAY);
+  MockSensor unpoweredSensor(SENSOR_TYPE, ADC_PIN);
+  mux.addSensor(firstSensor, 0);
+  mux.addSensor(secondSensor, 1);
+  mux.addSensor(unpoweredSensor, 2);
+  EXPECT_CALL(firstSensor, sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(secondSensor, sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(unpoweredSensor, sampleSensor()).Times(Exactly(1));
+  mux.scan();
+  EXPECT_EQ(clock.getDelayedMillis(), LONG_READ_DELAY) << "Scan must wait once for the slowest sensor"; // NOLINT
+  EXPECT_EQ(clock.getDelayedMicros(), 3 * Sensors::DEFAULT_MUX_SETTLE_MICROS)                          // NOLINT
+      << "Every bound channel must settle on the given clock";
+  Verify(Method(ArduinoFake(), delayMicroseconds)).Never();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SECOND_POWER_PIN, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SECOND_POWER_PIN, LOW)).Once();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(AnalogMuxTest, IsSkippingDelayWithoutPoweredSensors) { // NOLINT
+  stubMuxPins();
+  Timing::VirtualClock clock;
+  Sensors::AnalogMux mux(SELECT_PINS);
+  mux.setClock(clock);
+  MockSensor sensor(SENSOR_TYPE, ADC_PIN);
+  mux.addSensor(sensor, 0);
+  EXPECT_CALL(sensor, sampleSensor()).Times(Exactly(1));
+  mux.scan();
+  EXPECT_EQ(clock.getDelayedMillis(), 0) << "Scan waited without powered sensors"; // NOLINT
+}
+
+} // namespace
+#endif
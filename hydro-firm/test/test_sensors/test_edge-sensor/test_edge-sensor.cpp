@@ -0,0 +1,153 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <ArduinoFake.h>
+#include <gtest/gtest.h>
+#include <list>
+#include <memory>
+#include <sensors/edge-sensor/edge-sensor.hpp>
+
+#ifdef NATIVE
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+
+auto const INTERRUPT_PIN = 2;
+auto const SECOND_INTERRUPT_PIN = 3;
+auto const POLLED_PIN = 5;
+auto const FIRST_EDGE_MILLIS = 100;
+auto const SECOND_EDGE_MILLIS = 103;
+const char *const SENSOR_TYPE = "Float Switch";
+
+// Interrupt handler captured from the attachInterrupt() fake
+void (*pinChangeHandler)() = nullptr; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/*
+ * Stub the interrupt functions, capturing the attached handler, with the pin
+ * at the given level
+ */
+void stubInterrupts(const int level) {
+  ArduinoFakeReset();
+  pinChangeHandler = nullptr;
+  When(Method(ArduinoFake(), attachInterrupt)).AlwaysDo([](uint8_t, void (*handler)(), int) {
+    pinChangeHandler = handler;
+  });
+  When(Method(ArduinoFake(), detachInterrupt)).AlwaysReturn();
+  When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(level);
+}
+
+/*
+ * Inject an edge to the given level at the given time through the captured
+ * interrupt handler
+ */
+void injectEdge(const int level, const uint32_t now) {
+  When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(level);
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(now);
+  pinChangeHandler();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(EdgeSensorTest, IsAttachingPinChangeInterrupt) { // NOLINT
+  stubInterrupts(LOW);
+  Sensors::EdgeSensor sensor(SENSOR_TYPE, INTERRUPT_PIN, HIGH);
+  EXPECT_FALSE(sensor.isInterruptDriven()) << "Interrupt attached before begin"; // NOLINT
+  EXPECT_TRUE(sensor.begin()) << "Interrupt not attached";                       // NOLINT
+  EXPECT_TRUE(sensor.begin()) << "Attached sensor must stay attached";           // NOLINT
+  EXPECT_TRUE(sensor.isInterruptDriven()) << "Sensor not interrupt driven";      // NOLINT
+  EXPECT_NE(pinChangeHandler, nullptr) << "No handler attached";                 // NOLINT
+  Verify(Method(ArduinoFake(), attachInterrupt)).Once();
+  sensor.end();
+  sensor.end();
+  EXPECT_FALSE(sensor.isInterruptDriven()) << "Interrupt still attached after end"; // NOLINT
+  Verify(Method(ArduinoFake(), detachInterrupt).Using(digitalPinToInterrupt(INTERRUPT_PIN))).Once();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(EdgeSensorTest, IsPollingPinWithoutInterrupt) { // NOLINT
+  stubInterrupts(HIGH);
+  Sensors::EdgeSensor sensor(SENSOR_TYPE, POLLED_PIN, HIGH);
+  EXPECT_FALSE(sensor.begin()) << "Interrupt attached to a pin without one"; // NOLINT
+  sensor.sampleSensor();
+  EXPECT_EQ(sensor.getReading(), HIGH) << "Polled sensor must read the pin"; // NOLINT
+  Verify(Method(ArduinoFake(), attachInterrupt)).Never();
+  Verify(Method(ArduinoFake(), digitalRead).Using(POLLED_PIN)).Once();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(EdgeSensorTest, IsLatchingPulseBetweenReadCycles) { // NOLINT
+  stubInterrupts(LOW);
+  Sensors::EdgeSensor sensor(SENSOR_TYPE, INTERRUPT_PIN, HIGH);
+  sensor.begin();
+  sensor.sampleSensor();
+  EXPECT_EQ(sensor.getReading(), LOW) << "Reading must start at the pin level"; // NOLINT
+  EXPECT_FALSE(Sensors::hasPendingEdges()) << "Edges pending without an edge";  // NOLINT
+
+  injectEdge(HIGH, FIRST_EDGE_MILLIS);
+  injectEdge(LOW, SECOND_EDGE_MILLIS);
+  EXPECT_TRUE(Sensors::hasPendingEdges()) << "Latched edges not pending"; // NOLINT
+  sensor.sampleSensor();
+  EXPECT_FALSE(Sensors::hasPendingEdges()) << "Drained edges still pending";                    // NOLINT
+  EXPECT_EQ(sensor.getReading(), HIGH) << "Pulse between read cycles missed";                   // NOLINT
+  EXPECT_EQ(sensor.getLastDrain().edgeCount, 2) << "Incorrect number of edges";                 // NOLINT
+  EXPECT_EQ(sensor.getLastDrain().activeEdgeCount, 1) << "Incorrect number of active edges";    // NOLINT
+  EXPECT_EQ(sensor.getLastDrain().lastEdgeMillis, SECOND_EDGE_MILLIS) << "Incorrect timestamp"; // NOLINT
+
+  sensor.sampleSensor();
+  EXPECT_EQ(sensor.getReading(), LOW) << "Pulse reported for more than one cycle"; // NOLINT
+  EXPECT_EQ(sensor.getLastDrain().edgeCount, 0) << "Edges drained twice";          // NOLINT
+  Verify(Method(ArduinoFake(), digitalRead).Using(INTERRUPT_PIN)).Exactly(3);
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(EdgeSensorTest, IsReadingLevelAfterInactiveEdge) { // NOLINT
+  stubInterrupts(HIGH);
+  Sensors::EdgeSensor sensor(SENSOR_TYPE, INTERRUPT_PIN, LOW);
+  sensor.begin();
+  injectEdge(HIGH, FIRST_EDGE_MILLIS);
+  sensor.sampleSensor();
+  EXPECT_EQ(sensor.getReading(), HIGH) << "Inactive edge must read the pin level"; // NOLINT
+  EXPECT_EQ(sensor.getLastDrain().activeEdgeCount, 0) << "Inactive edge counted";  // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(EdgeSensorTest, AreInterruptLatchesBounded) { // NOLINT
+  stubInterrupts(LOW);
+  std::list<std::unique_ptr<Sensors::EdgeSensor>> sensors;
+  for (uint8_t slot = 0; slot < Sensors::MAX_EDGE_SENSORS; ++slot) {
+    sensors.emplace_back(new Sensors::EdgeSensor(SENSOR_TYPE, INTERRUPT_PIN, HIGH));
+    EXPECT_TRUE(sensors.back()->begin()) << "Free latch not attached"; // NOLINT
+  }
+  Sensors::EdgeSensor extraSensor(SENSOR_TYPE, SECOND_INTERRUPT_PIN, HIGH);
+  EXPECT_FALSE(extraSensor.begin()) << "Interrupt attached beyond the latches"; // NOLINT
+  sensors.pop_front();
+  EXPECT_TRUE(extraSensor.begin()) << "Released latch not reused"; // NOLINT
+}
+
+} // namespace
+#endif
@@ -0,0 +1,108 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <sensors/filter/filter.hpp>
+#include <tuple>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint8_t SAMPLE_COUNT = 9;
+const std::array<int16_t, SAMPLE_COUNT> NOISY_SAMPLES = {{512, 498, 4000, 505, 0, 510, 507, 502, 509}};
+const int16_t NOISY_SAMPLES_MEDIAN = 507;
+const int16_t NOISY_SAMPLES_MEAN = 838;
+// Mean of 502, 505, 507, 509, 510 after dropping 0, 498 and 512, 4000
+const int16_t NOISY_SAMPLES_TRIMMED_MEAN = 507;
+
+class FilterSortTest : public testing::TestWithParam<uint8_t> {};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables, modernize-use-trailing-return-type)
+INSTANTIATE_TEST_SUITE_P(SampleCounts, FilterSortTest, testing::Values(1, 2, 3, 8, 9, Sensors::MAX_SAMPLE_COUNT));
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_P(FilterSortTest, IsSortSamplesWorking) { // NOLINT
+  const uint8_t count = GetParam();
+  std::array<int16_t, Sensors::MAX_SAMPLE_COUNT> samples = {};
+  for (uint8_t index = 0; index < count; ++index) {
+    // Descending values with duplicates and the extremes of the 16 bit range
+    samples[index] = static_cast<int16_t>((count - index) / 2 * 1000 - (index == 0 ? 32000 : 0));
+  }
+  samples[count - 1] = INT16_MAX;
+  Sensors::sortSamples(samples.data(), count);
+  for (uint8_t index = 1; index < count; ++index) {
+    EXPECT_LE(samples[index - 1], samples[index]) << "Samples not sorted at " << +index; // NOLINT
+  }
+}
+
+TEST(FilterTest, IsMeanWorking) { // NOLINT
+  auto samples = NOISY_SAMPLES;
+  EXPECT_EQ(Sensors::meanOfSamples(samples.data(), SAMPLE_COUNT), NOISY_SAMPLES_MEAN) << "Wrong mean"; // NOLINT
+}
+
+TEST(FilterTest, IsMedianWorking) { // NOLINT
+  auto samples = NOISY_SAMPLES;
+  EXPECT_EQ(Sensors::medianOfSamples(samples.data(), SAMPLE_COUNT), NOISY_SAMPLES_MEDIAN) << "Wrong median"; // NOLINT
+}
+
+TEST(FilterTest, IsMedianOfEvenCountWorking) { // NOLINT
+  std::array<int16_t, 4> samples = {{7, 1, 4, 100}};
+  EXPECT_EQ(Sensors::medianOfSamples(samples.data(), samples.size()), 6) << "Wrong median of even count"; // NOLINT
+}
+
+TEST(FilterTest, IsTrimmedMeanWorking) { // NOLINT
+  auto samples = NOISY_SAMPLES;
+  EXPECT_EQ(Sensors::trimmedMeanOfSamples(samples.data(), SAMPLE_COUNT), NOISY_SAMPLES_TRIMMED_MEAN) // NOLINT
+      << "Wrong trimmed mean";
+}
+
+TEST(FilterTest, IsTrimmedMeanOfFewSamplesWorking) { // NOLINT
+  std::array<int16_t, 3> samples = {{3, 1, 2}};
+  EXPECT_EQ(Sensors::trimmedMeanOfSamples(samples.data(), samples.size()), 2) << "Wrong trimmed mean"; // NOLINT
+}
+
+class FilterSamplesTest : public testing::TestWithParam<std::tuple<Sensors::FILTER_TYPE, int16_t>> {};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables, modernize-use-trailing-return-type)
+INSTANTIATE_TEST_SUITE_P(FilterTypes, FilterSamplesTest,
+                         testing::Values(std::make_tuple(Sensors::MEAN, NOISY_SAMPLES_MEAN),
+                                         std::make_tuple(Sensors::MEDIAN, NOISY_SAMPLES_MEDIAN),
+                                         std::make_tuple(Sensors::TRIMMED_MEAN, NOISY_SAMPLES_TRIMMED_MEAN)));
+
+TEST_P(FilterSamplesTest, IsFilterSamplesWorking) { // NOLINT
+  auto samples = NOISY_SAMPLES;
+  EXPECT_EQ(Sensors::filterSamples(std::get<0>(GetParam()), samples.data(), SAMPLE_COUNT), std::get<1>(GetParam()))
+      << "Wrong filtered value"; // NOLINT
+}
+
+} // namespace
+#endif
@@ -37,13 +37,15 @@
 class MockReadSensors : public Sensors::ReadSensors {
 public:
   // NOLINTNEXTLINE
-  explicit MockReadSensors(std::list<Sensors::Sensor *> &sensors) : Sensors::ReadSensors(sensors) {}
+  explicit MockReadSensors(Sensors::SensorRegistry &sensors) : Sensors::ReadSensors(sensors) {}
   // NOLINTNEXTLINE
   MOCK_METHOD(void, readAllSensors, (), (override));
   // NOLINTNEXTLINE
-  MOCK_METHOD((std::map<const std::string, int>), getAllSensorReading, (), (const, override));
+  MOCK_METHOD(const Sensors::ReadingSnapshot &, getAllSensorReading, (), (const, override));
   // NOLINTNEXTLINE
-  MOCK_METHOD(int, getSensorReading, (const std::string &sensorName), (override));
+  MOCK_METHOD(int, getSensorReading, (const char *sensorName), (override));
+  // NOLINTNEXTLINE
+  MOCK_METHOD(int, getSensorReadingById, (Sensors::SENSOR_ID sensorId), (const, override));
 };
 
 #endif
\ No newline at end of file
@@ -30,33 +30,44 @@
 
 #include "../mock-sensors.hpp"
 #include <ArduinoFake.h>
+#include <array>
 #include <gmock/gmock.h>
+#include <list>
 #include <memory>
+#include <sensors/analog-mux/analog-mux.hpp>
+#include <sensors/moisture-level/moisture-level.hpp>
 #include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/water-level/water-level.hpp>
+#include <timing/virtual-clock/virtual-clock.hpp>
 
 #ifdef NATIVE
 namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
 using ::testing::Exactly;
 using ::testing::Return;
 
 auto const READ_PIN = 1;
 auto const POWER_PIN = 2;
+auto const SECOND_POWER_PIN = 3;
+auto const SHORT_READ_DELAY = 10;
+auto const LONG_READ_DELAY = 40;
 auto const DEFAULT_READ_VALUE = 123;
-std::string const FIRST_SENSOR_TYPE = "First Sensor";
-std::string const SECOND_SENSOR_TYPE = "Second Sensor";
+const char *const FIRST_SENSOR_TYPE = "First Sensor";
+const char *const SECOND_SENSOR_TYPE = "Second Sensor";
+const std::array<uint8_t, Sensors::MUX_SELECT_LINES> SELECT_PINS = {12, 13, 14, 15};
 
 //  cppcheck-suppress [syntaxError,unmatchedSuppression]
 TEST(ReadSensorsTest, IsReadSingleSensorsWorking) { // NOLINT
 
   auto const mockSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN));
-  std::list<Sensors::Sensor *> sensors = {mockSensor.get()}; // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors = {mockSensor.get()};
   auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
   EXPECT_CALL(*mockSensor.get(), readSensor()).Times(Exactly(1));
-  EXPECT_CALL(*mockSensor.get(), getType()).Times(Exactly(1)).WillOnce(Return(FIRST_SENSOR_TYPE));
+  EXPECT_CALL(*mockSensor.get(), getType()).WillRepeatedly(Return(FIRST_SENSOR_TYPE));
   EXPECT_CALL(*mockSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
   readSensors->readAllSensors();
-  EXPECT_EQ(readSensors->getAllSensorReading().size(), 1) << "Size of Sensor reading map is incorrect "; // NOLINT
-  EXPECT_EQ(readSensors->getAllSensorReading()[FIRST_SENSOR_TYPE], DEFAULT_READ_VALUE)
+  EXPECT_EQ(readSensors->getAllSensorReading().count, 1) << "Size of Sensor reading snapshot is incorrect "; // NOLINT
+  EXPECT_EQ(readSensors->getAllSensorReading().getReading(mockSensor->getId()), DEFAULT_READ_VALUE)
       << "Incorect sensor reading"; // NOLINT
 }
 
@@ -64,44 +75,277 @@ TEST(ReadSensorsTest, IsReadSingleSensorsWorking) { // NOLINT
 TEST(ReadSensorsTest, IsReadAllSensorsWorking) { // NOLINT
   auto const mockFirstSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN));
   auto const mockSecondSensor = std::unique_ptr<MockSensor>(new MockSensor(SECOND_SENSOR_TYPE, READ_PIN, POWER_PIN));
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  std::list<Sensors::Sensor *> sensors = {mockFirstSensor.get(), mockSecondSensor.get()};
+  Sensors::SensorSet<2> sensors = {mockFirstSensor.get(), mockSecondSensor.get()};
   auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
   EXPECT_CALL(*mockFirstSensor.get(), readSensor()).Times(Exactly(1));
-  EXPECT_CALL(*mockFirstSensor.get(), getType()).Times(Exactly(1)).WillOnce(Return(FIRST_SENSOR_TYPE));
+  EXPECT_CALL(*mockFirstSensor.get(), getType()).WillRepeatedly(Return(FIRST_SENSOR_TYPE));
   EXPECT_CALL(*mockFirstSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
   EXPECT_CALL(*mockSecondSensor.get(), readSensor()).Times(Exactly(1));
-  EXPECT_CALL(*mockSecondSensor.get(), getType()).Times(Exactly(1)).WillOnce(Return(SECOND_SENSOR_TYPE));
+  EXPECT_CALL(*mockSecondSensor.get(), getType()).WillRepeatedly(Return(SECOND_SENSOR_TYPE));
   EXPECT_CALL(*mockSecondSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
   readSensors->readAllSensors();
-  EXPECT_EQ(readSensors->getAllSensorReading().size(), 2) << "Size of Sensor reading map is incorrect "; // NOLINT
-  EXPECT_EQ(readSensors->getAllSensorReading()[FIRST_SENSOR_TYPE], DEFAULT_READ_VALUE)
+  EXPECT_EQ(readSensors->getAllSensorReading().count, 2) << "Size of Sensor reading snapshot is incorrect "; // NOLINT
+  EXPECT_EQ(readSensors->getAllSensorReading().getReading(mockFirstSensor->getId()), DEFAULT_READ_VALUE)
       << "Incorect sensor reading"; // NOLINT
-  EXPECT_EQ(readSensors->getAllSensorReading()[SECOND_SENSOR_TYPE], DEFAULT_READ_VALUE)
+  EXPECT_EQ(readSensors->getAllSensorReading().getReading(mockSecondSensor->getId()), DEFAULT_READ_VALUE)
       << "Incorect sensor reading"; // NOLINT
 }
 
 //  cppcheck-suppress [syntaxError,unmatchedSuppression]
-TEST(ReadSensorsTest, EmptySensorList) {     // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
+TEST(ReadSensorsTest, EmptySensorList) { // NOLINT
+  Sensors::SensorSet<1> sensors;
   auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
   readSensors->readAllSensors();
-  EXPECT_EQ(readSensors->getAllSensorReading().size(), 0) << "Size of Sensor reading map is incorrect "; // NOLINT
+  EXPECT_EQ(readSensors->getAllSensorReading().count, 0) << "Size of Sensor reading snapshot is incorrect "; // NOLINT
 }
 
 //  cppcheck-suppress [syntaxError,unmatchedSuppression]
 TEST(ReadSensorsTest, GetSensorReading) { // NOLINT
 
   auto const mockSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN));
-  std::list<Sensors::Sensor *> sensors = {mockSensor.get()}; // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors = {mockSensor.get()};
   auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
   EXPECT_CALL(*mockSensor.get(), readSensor()).Times(Exactly(1));
-  EXPECT_CALL(*mockSensor.get(), getType()).Times(Exactly(1)).WillOnce(Return(FIRST_SENSOR_TYPE));
+  EXPECT_CALL(*mockSensor.get(), getType()).WillRepeatedly(Return(FIRST_SENSOR_TYPE));
   EXPECT_CALL(*mockSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
   readSensors->readAllSensors();
   EXPECT_EQ(readSensors->getSensorReading(FIRST_SENSOR_TYPE), DEFAULT_READ_VALUE)
       << "Incorrect sensor reading"; // NOLINT
 }
 
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsBatchedReadWaitingOnceForSlowestSensor) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), delay)).AlwaysReturn();
+  auto const mockFirstSensor =
+      std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN, SHORT_READ_DELAY));
+  auto const mockSecondSensor =
+      std::unique_ptr<MockSensor>(new MockSensor(SECOND_SENSOR_TYPE, READ_PIN, SECOND_POWER_PIN, LONG_READ_DELAY));
+  Sensors::SensorSet<2> sensors = {mockFirstSensor.get(), mockSecondSensor.get()};
+  auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors, Sensors::BATCHED));
+  EXPECT_CALL(*mockFirstSensor.get(), readSensor()).Times(Exactly(0));
+  EXPECT_CALL(*mockFirstSensor.get(), sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(*mockFirstSensor.get(), getType()).WillRepeatedly(Return(FIRST_SENSOR_TYPE));
+  EXPECT_CALL(*mockFirstSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  EXPECT_CALL(*mockSecondSensor.get(), readSensor()).Times(Exactly(0));
+  EXPECT_CALL(*mockSecondSensor.get(), sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(*mockSecondSensor.get(), getType()).WillRepeatedly(Return(SECOND_SENSOR_TYPE));
+  EXPECT_CALL(*mockSecondSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  readSensors->readAllSensors();
+  EXPECT_EQ(readSensors->getAllSensorReading().count, 2) << "Size of Sensor reading snapshot is incorrect "; // NOLINT
+  EXPECT_EQ(readSensors->getSensorReading(SECOND_SENSOR_TYPE), DEFAULT_READ_VALUE)
+      << "Incorrect sensor reading"; // NOLINT
+  Verify(Method(ArduinoFake(), delay)).Once();
+  Verify(Method(ArduinoFake(), delay).Using(LONG_READ_DELAY)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SECOND_POWER_PIN, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SECOND_POWER_PIN, LOW)).Once();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsBatchedReadWaitingOnTheGivenClock) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  Timing::VirtualClock clock;
+  auto const mockSensor =
+      std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN, LONG_READ_DELAY));
+  Sensors::SensorSet<1> sensors = {mockSensor.get()};
+  Sensors::ReadSensors readSensors(sensors, Sensors::BATCHED, clock);
+  EXPECT_CALL(*mockSensor.get(), sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(*mockSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  readSensors.readAllSensors();
+  EXPECT_EQ(clock.getDelayedMillis(), LONG_READ_DELAY) << "Read delay must be waited on the given clock"; // NOLINT
+  Verify(Method(ArduinoFake(), delay)).Never();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsClockHandedToTheSensors) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), analogRead)).AlwaysReturn(DEFAULT_READ_VALUE);
+  When(Method(ArduinoFake(), digitalRead)).AlwaysReturn(HIGH);
+  Timing::VirtualClock clock;
+  Sensors::MoistureLevelSensor sensor(READ_PIN, POWER_PIN);
+  Sensors::SensorSet<1> sensors = {&sensor};
+  Sensors::ReadSensors readSensors(sensors, Sensors::SEQUENTIAL, clock);
+  readSensors.readAllSensors();
+  EXPECT_EQ(clock.getDelayedMillis(), sensor.getReadDelay()) << "Sensor must wait on the given clock"; // NOLINT
+  Verify(Method(ArduinoFake(), delay)).Never();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsClockHandedToLaterSensors) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), analogRead)).AlwaysReturn(DEFAULT_READ_VALUE);
+  Timing::VirtualClock clock;
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors, Sensors::SEQUENTIAL, clock);
+  Sensors::MoistureLevelSensor sensor(READ_PIN, POWER_PIN);
+  sensors.add(sensor);
+  readSensors.readAllSensors();
+  EXPECT_EQ(clock.getDelayedMillis(), sensor.getReadDelay()) << "Later sensor must wait on the given clock"; // NOLINT
+  Verify(Method(ArduinoFake(), delay)).Never();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsBatchedReadSkippingDelayWithoutPoweredSensors) { // NOLINT
+  ArduinoFakeReset();
+  auto const mockSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN));
+  Sensors::SensorSet<1> sensors = {mockSensor.get()};
+  auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors, Sensors::BATCHED));
+  EXPECT_CALL(*mockSensor.get(), sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(*mockSensor.get(), getType()).WillRepeatedly(Return(FIRST_SENSOR_TYPE));
+  EXPECT_CALL(*mockSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  readSensors->readAllSensors();
+  EXPECT_EQ(readSensors->getSensorReading(FIRST_SENSOR_TYPE), DEFAULT_READ_VALUE)
+      << "Incorrect sensor reading"; // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, AreSensorIdsAssignedOnRegistration) { // NOLINT
+  auto const mockFirstSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN));
+  auto const mockSecondSensor = std::unique_ptr<MockSensor>(new MockSensor(SECOND_SENSOR_TYPE, READ_PIN, POWER_PIN));
+  Sensors::SensorSet<2> sensors = {mockFirstSensor.get(), mockSecondSensor.get()};
+  auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
+  EXPECT_CALL(*mockFirstSensor.get(), getType()).WillRepeatedly(Return(FIRST_SENSOR_TYPE));
+  EXPECT_CALL(*mockSecondSensor.get(), getType()).WillRepeatedly(Return(SECOND_SENSOR_TYPE));
+  EXPECT_EQ(readSensors->getSensorCount(), 2) << "Wrong number of registered sensors";       // NOLINT
+  EXPECT_EQ(mockFirstSensor->getId(), 0) << "Wrong identifier for the first sensor";         // NOLINT
+  EXPECT_EQ(mockSecondSensor->getId(), 1) << "Wrong identifier for the second sensor";       // NOLINT
+  EXPECT_EQ(readSensors->getSensorId(SECOND_SENSOR_TYPE), 1) << "Wrong identifier for type"; // NOLINT
+  EXPECT_EQ(readSensors->getSensorId("Unknown Sensor"), Sensors::INVALID_SENSOR_ID)          // NOLINT
+      << "Identifier found for an unknown type";
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsMatchingNameConstantOrCopy) { // NOLINT
+  Sensors::MoistureLevelSensor moistureSensor(READ_PIN, POWER_PIN);
+  Sensors::WaterLevelSensor waterSensor(READ_PIN, POWER_PIN);
+  Sensors::SensorSet<2> sensors = {&moistureSensor, &waterSensor};
+  Sensors::ReadSensors readSensors(sensors);
+  const std::array<char, sizeof("Water Level Sensor")> nameCopy = {"Water Level Sensor"};
+  EXPECT_EQ(readSensors.getSensorId(Sensors::MOISTURE_LEVEL_SENSOR), moistureSensor.getId()) // NOLINT
+      << "Sensor not found by its name constant";
+  EXPECT_EQ(readSensors.getSensorId(nameCopy.data()), waterSensor.getId()) // NOLINT
+      << "Sensor not found by a copy of its name";
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, AreSensorsBeyondCapacityNotRegistered) { // NOLINT
+  std::list<std::unique_ptr<MockSensor>> mockSensors;
+  Sensors::SensorSet<Sensors::MAX_SENSORS> sensors;
+  for (int i = 0; i <= Sensors::MAX_SENSORS; ++i) {
+    mockSensors.emplace_back(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN));
+    sensors.add(*mockSensors.back());
+  }
+  auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
+  EXPECT_EQ(readSensors->getSensorCount(), Sensors::MAX_SENSORS) << "Sensors registered beyond capacity";      // NOLINT
+  EXPECT_EQ(mockSensors.back()->getId(), Sensors::INVALID_SENSOR_ID) << "Identifier assigned beyond capacity"; // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsReadingByIdNotLookingUpType) { // NOLINT
+  auto const mockFirstSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN));
+  auto const mockSecondSensor = std::unique_ptr<MockSensor>(new MockSensor(SECOND_SENSOR_TYPE, READ_PIN, POWER_PIN));
+  Sensors::SensorSet<2> sensors = {mockFirstSensor.get(), mockSecondSensor.get()};
+  auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
+  EXPECT_CALL(*mockFirstSensor.get(), readSensor()).Times(Exactly(1));
+  EXPECT_CALL(*mockFirstSensor.get(), getType()).Times(Exactly(0));
+  EXPECT_CALL(*mockFirstSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  EXPECT_CALL(*mockSecondSensor.get(), readSensor()).Times(Exactly(1));
+  EXPECT_CALL(*mockSecondSensor.get(), getType()).Times(Exactly(0));
+  EXPECT_CALL(*mockSecondSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE + 1));
+  readSensors->readAllSensors();
+  EXPECT_EQ(readSensors->getSensorReadingById(mockFirstSensor->getId()), DEFAULT_READ_VALUE) // NOLINT
+      << "Incorrect sensor reading";
+  EXPECT_EQ(readSensors->getSensorReadingById(mockSecondSensor->getId()), DEFAULT_READ_VALUE + 1) // NOLINT
+      << "Incorrect sensor reading";
+  EXPECT_EQ(readSensors->getSensorReadingById(Sensors::INVALID_SENSOR_ID), 0) // NOLINT
+      << "Reading returned for an unregistered identifier";
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsSnapshotPublishedOncePerReadCycle) { // NOLINT
+  auto const mockSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN));
+  Sensors::SensorSet<1> sensors = {mockSensor.get()};
+  auto readSensors = std::unique_ptr<Sensors::ReadSensors>(new Sensors::ReadSensors(sensors));
+  EXPECT_CALL(*mockSensor.get(), readSensor()).Times(Exactly(2));
+  EXPECT_CALL(*mockSensor.get(), getReading())
+      .Times(2)
+      .WillOnce(Return(DEFAULT_READ_VALUE))
+      .WillOnce(Return(DEFAULT_READ_VALUE + 1));
+  EXPECT_EQ(readSensors->getAllSensorReading().sequence, 0) << "Snapshot published before reading"; // NOLINT
+  EXPECT_EQ(readSensors->getAllSensorReading().count, 0) << "Snapshot published before reading";    // NOLINT
+
+  readSensors->readAllSensors();
+  const Sensors::ReadingSnapshot &firstSnapshot = readSensors->getAllSensorReading();
+  EXPECT_EQ(firstSnapshot.sequence, 1) << "Incorrect snapshot sequence";                               // NOLINT
+  EXPECT_EQ(firstSnapshot.getReading(mockSensor->getId()), DEFAULT_READ_VALUE) << "Incorrect reading"; // NOLINT
+
+  readSensors->readAllSensors();
+  const Sensors::ReadingSnapshot &secondSnapshot = readSensors->getAllSensorReading();
+  EXPECT_NE(&firstSnapshot, &secondSnapshot) << "Snapshot published into the front buffer";                    // NOLINT
+  EXPECT_EQ(secondSnapshot.sequence, 2) << "Incorrect snapshot sequence";                                      // NOLINT
+  EXPECT_EQ(secondSnapshot.getReading(mockSensor->getId()), DEFAULT_READ_VALUE + 1) << "Incorrect reading";    // NOLINT
+  EXPECT_EQ(firstSnapshot.getReading(mockSensor->getId()), DEFAULT_READ_VALUE) << "Previous snapshot changed"; // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsReadingMuxSensorsWithOneScan) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), delayMicroseconds)).AlwaysReturn();
+  Timing::VirtualClock clock;
+  auto const directSensor = std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN));
+  auto const muxSensor =
+      std::unique_ptr<MockSensor>(new MockSensor(SECOND_SENSOR_TYPE, A0, POWER_PIN, LONG_READ_DELAY));
+  Sensors::SensorSet<2> sensors = {directSensor.get(), muxSensor.get()};
+  Sensors::AnalogMux mux(SELECT_PINS);
+  mux.addSensor(*muxSensor, 1);
+  Sensors::ReadSensors readSensors(sensors, Sensors::SEQUENTIAL, clock);
+  readSensors.setAnalogMux(mux);
+  EXPECT_CALL(*directSensor.get(), readSensor()).Times(Exactly(1));
+  EXPECT_CALL(*directSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  EXPECT_CALL(*muxSensor.get(), readSensor()).Times(Exactly(0));
+  EXPECT_CALL(*muxSensor.get(), sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(*muxSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE + 1));
+  readSensors.readAllSensors();
+  EXPECT_EQ(readSensors.getSensorReadingById(directSensor->getId()), DEFAULT_READ_VALUE) // NOLINT
+      << "Incorrect direct sensor reading";
+  EXPECT_EQ(readSensors.getSensorReadingById(muxSensor->getId()), DEFAULT_READ_VALUE + 1) // NOLINT
+      << "Incorrect multiplexed sensor reading";
+  EXPECT_EQ(clock.getDelayedMillis(), LONG_READ_DELAY) << "Scan must wait on the given clock"; // NOLINT
+  Verify(Method(ArduinoFake(), delay)).Never();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(ReadSensorsTest, IsBatchedReadLeavingMuxSensorsToTheScan) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), delayMicroseconds)).AlwaysReturn();
+  Timing::VirtualClock clock;
+  auto const directSensor =
+      std::unique_ptr<MockSensor>(new MockSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN, SHORT_READ_DELAY));
+  auto const muxSensor =
+      std::unique_ptr<MockSensor>(new MockSensor(SECOND_SENSOR_TYPE, A0, SECOND_POWER_PIN, LONG_READ_DELAY));
+  Sensors::SensorSet<2> sensors = {directSensor.get(), muxSensor.get()};
+  Sensors::AnalogMux mux(SELECT_PINS);
+  mux.addSensor(*muxSensor, 0);
+  Sensors::ReadSensors readSensors(sensors, Sensors::BATCHED, clock);
+  readSensors.setAnalogMux(mux);
+  EXPECT_CALL(*directSensor.get(), sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(*directSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  EXPECT_CALL(*muxSensor.get(), sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(*muxSensor.get(), getReading()).Times(1).WillOnce(Return(DEFAULT_READ_VALUE));
+  readSensors.readAllSensors();
+  EXPECT_EQ(clock.getDelayedMillis(), SHORT_READ_DELAY + LONG_READ_DELAY) // NOLINT
+      << "Batch and scan must each wait once";
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SECOND_POWER_PIN, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SECOND_POWER_PIN, LOW)).Once();
+}
+
 } // namespace
 #endif
\ No newline at end of file
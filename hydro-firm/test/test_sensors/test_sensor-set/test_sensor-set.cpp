@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../mock-sensors.hpp"
+#include <gtest/gtest.h>
+#include <sensors/sensor-set/sensor-set.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint8_t READ_PIN = 1;
+const uint8_t POWER_PIN = 2;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SensorSetTest, AreSensorsRegisteredInOrder) { // NOLINT
+  MockSensor firstSensor("First Sensor", READ_PIN, POWER_PIN);
+  MockSensor secondSensor("Second Sensor", READ_PIN, POWER_PIN);
+  Sensors::SensorSet<2> sensors = {&firstSensor, &secondSensor};
+  EXPECT_EQ(sensors.size(), 2) << "Incorrect number of sensors";                   // NOLINT
+  EXPECT_EQ(sensors.getCapacity(), 2) << "Incorrect capacity";                     // NOLINT
+  EXPECT_EQ(firstSensor.getId(), 0) << "Incorrect identifier for first sensor";    // NOLINT
+  EXPECT_EQ(secondSensor.getId(), 1) << "Incorrect identifier for second sensor";  // NOLINT
+  EXPECT_EQ(sensors[0], &firstSensor) << "First sensor not found by identifier";   // NOLINT
+  EXPECT_EQ(sensors[1], &secondSensor) << "Second sensor not found by identifier"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SensorSetTest, IsIterationInIdentifierOrder) { // NOLINT
+  MockSensor firstSensor("First Sensor", READ_PIN, POWER_PIN);
+  MockSensor secondSensor("Second Sensor", READ_PIN, POWER_PIN);
+  Sensors::SensorSet<3> sensors;
+  sensors.add(firstSensor);
+  sensors.add(secondSensor);
+  Sensors::SENSOR_ID expectedId = 0;
+  for (auto *sensor : sensors) {
+    EXPECT_EQ(sensor->getId(), expectedId) << "Sensors iterated out of order"; // NOLINT
+    ++expectedId;
+  }
+  EXPECT_EQ(expectedId, 2) << "Unregistered slots iterated"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SensorSetTest, IsAddRejectedWhenFull) { // NOLINT
+  MockSensor firstSensor("First Sensor", READ_PIN, POWER_PIN);
+  MockSensor secondSensor("Second Sensor", READ_PIN, POWER_PIN);
+  Sensors::SensorSet<1> sensors;
+  EXPECT_EQ(sensors.add(firstSensor), 0) << "Sensor not registered";                                 // NOLINT
+  EXPECT_EQ(sensors.add(secondSensor), Sensors::INVALID_SENSOR_ID) << "Sensor registered when full"; // NOLINT
+  EXPECT_EQ(secondSensor.getId(), Sensors::INVALID_SENSOR_ID) << "Identifier assigned when full";    // NOLINT
+  EXPECT_EQ(sensors.size(), 1) << "Incorrect number of sensors";                                     // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -33,13 +33,14 @@
 #include <memory>
 #include <sensors/sensor.hpp>
 #include <string>
+#include <timing/virtual-clock/virtual-clock.hpp>
 
 #ifdef NATIVE
 
 using namespace fakeit; // NOLINT(google-build-using-namespace)
 
 namespace {
-const std::string SENSOR_TYPE = "Test Sensor";
+const char *const SENSOR_TYPE = "Test Sensor";
 const uint8_t READ_PIN = A0;
 const uint8_t POWER_PIN = A1;
 const int DEFAULT_DELAY = 10;
@@ -56,6 +57,8 @@ public:
       : Sensor(SENSOR_TYPE, isAnalogOrDigital, readPin, powerPin) {}
   TestSensor(Sensors::SENSOR_TYPE isAnalogOrDigital, uint8_t readPin)
       : Sensor(SENSOR_TYPE, isAnalogOrDigital, readPin) {}
+  TestSensor(Sensors::SENSOR_TYPE isAnalogOrDigital, uint8_t readPin, uint8_t powerPin, int16_t readDelay)
+      : Sensor(SENSOR_TYPE, isAnalogOrDigital, readPin, powerPin, readDelay) {}
 };
 
 // cppcheck-suppress [syntaxError,unmatchedSuppression]
@@ -83,6 +86,17 @@ TEST_F(SensorTest, IsReadAnalogSensorWorking) { // NOLINT
   Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, LOW)).Once();
 }
 
+TEST_F(SensorTest, IsReadSensorWaitingOnTheGivenClock) { // NOLINT
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), analogRead)).AlwaysReturn(EXPECTED_READING);
+  Timing::VirtualClock clock;
+  TestSensor testAnalogSensor(Sensors::SENSOR_TYPE::ANALOG, READ_PIN, POWER_PIN);
+  testAnalogSensor.setClock(clock);
+  testAnalogSensor.readSensor();
+  EXPECT_EQ(clock.millis(), DEFAULT_DELAY) << "Read delay must advance the given clock"; // NOLINT
+  Verify(Method(ArduinoFake(), delay)).Never();
+}
+
 TEST_F(SensorTest, IsReadAnalogSensorWithoutPowerOnWorking) { // NOLINT
   When(Method(ArduinoFake(), analogRead)).AlwaysReturn(EXPECTED_READING);
   const uint8_t readPin = A0;
@@ -134,5 +148,52 @@ TEST_F(SensorTest, IsSensorResetWorking) { // NOLINT
   EXPECT_EQ(testdigitalSensor.getReading(), 0) << "Sensor reset is not working"; // NOLINT
 }
 
+TEST_F(SensorTest, IsReadSensorWithCustomDelayWorking) { // NOLINT
+  const int16_t readDelay = 25;
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), delay)).AlwaysReturn();
+  When(Method(ArduinoFake(), analogRead)).AlwaysReturn(EXPECTED_READING);
+  TestSensor testAnalogSensor(Sensors::SENSOR_TYPE::ANALOG, READ_PIN, POWER_PIN, readDelay);
+  EXPECT_TRUE(testAnalogSensor.isPowerOnRequired()) << "Sensor with power pin does not require power on"; // NOLINT
+  EXPECT_EQ(testAnalogSensor.getReadDelay(), readDelay) << "Custom read delay not set";                   // NOLINT
+  testAnalogSensor.readSensor();
+  EXPECT_EQ(testAnalogSensor.getReading(), EXPECTED_READING)
+      << "Sensor reading is different from the expected reading"; // NOLINT
+  Verify(Method(ArduinoFake(), delay).Using(readDelay)).Once();
+}
+
+TEST_F(SensorTest, IsSampleSensorWorking) { // NOLINT
+  When(Method(ArduinoFake(), analogRead)).AlwaysReturn(EXPECTED_READING);
+  TestSensor testAnalogSensor(Sensors::SENSOR_TYPE::ANALOG, READ_PIN, POWER_PIN);
+  testAnalogSensor.sampleSensor();
+  EXPECT_EQ(testAnalogSensor.getReading(), EXPECTED_READING)
+      << "Sensor reading is different from the expected reading"; // NOLINT
+  Verify(Method(ArduinoFake(), analogRead).Using(READ_PIN)).Once();
+}
+
+TEST_F(SensorTest, IsSensorWithoutPowerOnNotRequiringPower) { // NOLINT
+  TestSensor testAnalogSensor(Sensors::SENSOR_TYPE::ANALOG, READ_PIN);
+  EXPECT_FALSE(testAnalogSensor.isPowerOnRequired()) << "Sensor without power pin requires power on"; // NOLINT
+}
+
+TEST_F(SensorTest, IsOversamplingWorking) { // NOLINT
+  const uint8_t sampleCount = 5;
+  When(Method(ArduinoFake(), analogRead)).Return(120, 1023, 123, 0, 125);
+  TestSensor testAnalogSensor(Sensors::SENSOR_TYPE::ANALOG, READ_PIN);
+  testAnalogSensor.setOversampling(sampleCount, Sensors::MEDIAN);
+  testAnalogSensor.readSensor();
+  EXPECT_EQ(testAnalogSensor.getReading(), EXPECTED_READING) << "Oversampled reading is not the median"; // NOLINT
+  Verify(Method(ArduinoFake(), analogRead).Using(READ_PIN)).Exactly(sampleCount);
+}
+
+TEST_F(SensorTest, IsOversamplingLimited) { // NOLINT
+  TestSensor testAnalogSensor(Sensors::SENSOR_TYPE::ANALOG, READ_PIN);
+  testAnalogSensor.setOversampling(0, Sensors::TRIMMED_MEAN);
+  EXPECT_EQ(testAnalogSensor.getSampleCount(), 1) << "Sample count below the limit";      // NOLINT
+  EXPECT_EQ(testAnalogSensor.getFilterType(), Sensors::TRIMMED_MEAN) << "Filter not set"; // NOLINT
+  testAnalogSensor.setOversampling(Sensors::MAX_SAMPLE_COUNT + 1, Sensors::MEAN);
+  EXPECT_EQ(testAnalogSensor.getSampleCount(), Sensors::MAX_SAMPLE_COUNT) << "Sample count above the limit"; // NOLINT
+}
+
 } // namespace
 #endif
\ No newline at end of file
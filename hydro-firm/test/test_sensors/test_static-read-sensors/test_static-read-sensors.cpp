@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../mock-sensors.hpp"
+#include <ArduinoFake.h>
+#include <gmock/gmock.h>
+#include <sensors/static-read-sensors/static-read-sensors.hpp>
+#include <sensors/water-level/water-level.hpp>
+#include <timing/virtual-clock/virtual-clock.hpp>
+
+#ifdef NATIVE
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+using ::testing::Exactly;
+using ::testing::Return;
+
+auto const READ_PIN = 1;
+auto const POWER_PIN = 2;
+auto const SECOND_POWER_PIN = 3;
+auto const SHORT_READ_DELAY = 10;
+auto const LONG_READ_DELAY = 40;
+auto const DEFAULT_READ_VALUE = 123;
+const char *const FIRST_SENSOR_TYPE = "First Sensor";
+const char *const SECOND_SENSOR_TYPE = "Second Sensor";
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StaticReadSensorsTest, IsReadingSensorsInOrder) { // NOLINT
+  MockSensor firstSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN);
+  MockSensor secondSensor(SECOND_SENSOR_TYPE, READ_PIN, POWER_PIN);
+  Sensors::StaticReadSensors<MockSensor, MockSensor> readSensors(firstSensor, secondSensor);
+  EXPECT_CALL(firstSensor, readSensor()).Times(Exactly(1));
+  EXPECT_CALL(firstSensor, getReading()).WillOnce(Return(DEFAULT_READ_VALUE));
+  EXPECT_CALL(secondSensor, readSensor()).Times(Exactly(1));
+  EXPECT_CALL(secondSensor, getReading()).WillOnce(Return(DEFAULT_READ_VALUE + 1));
+  EXPECT_CALL(secondSensor, getType()).WillRepeatedly(Return(SECOND_SENSOR_TYPE));
+  readSensors.readAllSensors();
+  EXPECT_EQ(readSensors.getSensorCount(), 2) << "Wrong number of registered sensors";                   // NOLINT
+  EXPECT_EQ(readSensors.getSequence(), 1) << "Snapshot not published";                                  // NOLINT
+  EXPECT_EQ(readSensors.getSensorReadingById(0), DEFAULT_READ_VALUE) << "Incorrect first reading";      // NOLINT
+  EXPECT_EQ(readSensors.getSensorReadingById(1), DEFAULT_READ_VALUE + 1) << "Incorrect second reading"; // NOLINT
+  EXPECT_EQ(readSensors.getSensorId(SECOND_SENSOR_TYPE), 1) << "Wrong identifier for type";             // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StaticReadSensorsTest, IsBatchedReadWaitingOnceForSlowestSensor) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  Timing::VirtualClock clock;
+  MockSensor firstSensor(FIRST_SENSOR_TYPE, READ_PIN, POWER_PIN, SHORT_READ_DELAY);
+  MockSensor secondSensor(SECOND_SENSOR_TYPE, READ_PIN, SECOND_POWER_PIN, LONG_READ_DELAY);
+  MockSensor unpoweredSensor(SECOND_SENSOR_TYPE, READ_PIN);
+  Sensors::StaticReadSensors<MockSensor, MockSensor, MockSensor> readSensors(firstSensor, secondSensor,
+                                                                             unpoweredSensor, Sensors::BATCHED, clock);
+  EXPECT_CALL(firstSensor, readSensor()).Times(Exactly(0));
+  EXPECT_CALL(firstSensor, sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(firstSensor, getReading()).WillOnce(Return(DEFAULT_READ_VALUE));
+  EXPECT_CALL(secondSensor, sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(secondSensor, getReading()).WillOnce(Return(DEFAULT_READ_VALUE));
+  EXPECT_CALL(unpoweredSensor, sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(unpoweredSensor, getReading()).WillOnce(Return(DEFAULT_READ_VALUE));
+  readSensors.readAllSensors();
+  EXPECT_EQ(clock.getDelayedMillis(), LONG_READ_DELAY) << "Batch must wait once for the slowest sensor"; // NOLINT
+  Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(SECOND_POWER_PIN, LOW)).Once();
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StaticReadSensorsTest, IsBatchedReadSkippingDelayWithoutPoweredSensors) { // NOLINT
+  Timing::VirtualClock clock;
+  MockSensor sensor(FIRST_SENSOR_TYPE, READ_PIN);
+  Sensors::StaticReadSensors<MockSensor> readSensors(sensor, Sensors::BATCHED, clock);
+  EXPECT_CALL(sensor, sampleSensor()).Times(Exactly(1));
+  EXPECT_CALL(sensor, getReading()).WillOnce(Return(DEFAULT_READ_VALUE));
+  readSensors.readAllSensors();
+  EXPECT_EQ(clock.getDelayedMillis(), 0) << "Batch waited without powered sensors"; // NOLINT
+}
+
+//  cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(StaticReadSensorsTest, IsReadingFinalSensorKinds) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  When(Method(ArduinoFake(), analogRead)).AlwaysReturn(DEFAULT_READ_VALUE);
+  Timing::VirtualClock clock;
+  Sensors::WaterLevelSensor waterLevelSensor(READ_PIN, POWER_PIN);
+  Sensors::StaticReadSensors<Sensors::WaterLevelSensor> readSensors(waterLevelSensor, Sensors::SEQUENTIAL, clock);
+  readSensors.readAllSensors();
+  EXPECT_EQ(readSensors.getSensorReading(Sensors::WATER_LEVEL_SENSOR), DEFAULT_READ_VALUE) // NOLINT
+      << "Incorrect water level reading";
+  EXPECT_EQ(clock.getDelayedMillis(), waterLevelSensor.getReadDelay()) << "Read delay not waited"; // NOLINT
+}
+
+} // namespace
+#endif
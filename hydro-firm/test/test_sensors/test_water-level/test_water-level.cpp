@@ -54,6 +54,10 @@ TEST_F(WaterLevelSensorTest, IsConstructorWorking) { // NOLINT
       << "Constructor initialization of member variable for Water Level Sensor: type not woring"; // NOLINT
   EXPECT_EQ(waterLevelSensor.getReading(), 0)
       << "Constructor initialization of member variable for Water Level Sensor: reading not woring"; // NOLINT
+  EXPECT_EQ(waterLevelSensor.getSampleCount(), Sensors::WATER_LEVEL_SAMPLE_COUNT)
+      << "Constructor initialization of member variable for Water Level Sensor: sample count not working"; // NOLINT
+  EXPECT_EQ(waterLevelSensor.getFilterType(), Sensors::WATER_LEVEL_FILTER)
+      << "Constructor initialization of member variable for Water Level Sensor: filter not working"; // NOLINT
 }
 
 TEST_F(WaterLevelSensorTest, IsReadWaterLevelSensorWorking) { // NOLINT
@@ -68,7 +72,7 @@ TEST_F(WaterLevelSensorTest, IsReadWaterLevelSensorWorking) { // NOLINT
       << "Sensor reading is different from the expected reading"; // NOLINT
   Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, HIGH)).Once();
   Verify(Method(ArduinoFake(), delay).Using(DEFAULT_DELAY)).Once();
-  Verify(Method(ArduinoFake(), analogRead).Using(READ_PIN)).Once();
+  Verify(Method(ArduinoFake(), analogRead).Using(READ_PIN)).Exactly(Sensors::WATER_LEVEL_SAMPLE_COUNT);
   Verify(Method(ArduinoFake(), digitalWrite).Using(POWER_PIN, LOW)).Once();
 }
 
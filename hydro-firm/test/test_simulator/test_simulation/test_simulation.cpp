@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <ArduinoFake.h>
+#include <gtest/gtest.h>
+#include <simulator/simulation/simulation.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t SIMULATED_DAYS = 10;
+
+auto totalModeMillis(const Simulator::SimulationReport &report) -> uint64_t {
+  uint64_t total = 0;
+  for (const auto millis : report.modeMillis) {
+    total += millis;
+  }
+  return total;
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SimulationTest, IsStayingInCoolDownWithoutTimer) { // NOLINT
+  Simulator::Simulation simulation;
+  simulation.run(Simulator::DAY_MILLIS);
+  const auto &report = simulation.getReport();
+  EXPECT_EQ(report.simulatedMillis, Simulator::DAY_MILLIS) << "Whole day must be simulated";   // NOLINT
+  EXPECT_EQ(totalModeMillis(report), report.simulatedMillis) << "Every moment has a mode";     // NOLINT
+  EXPECT_EQ(report.pumpCycles, 1) << "Forced watering must fill the container once";           // NOLINT
+  EXPECT_GT(report.pumpOnMillis, 0) << "Pump must run while filling";                          // NOLINT
+  EXPECT_EQ(report.modeMillis[System::ACTIVE_MODE], 0) << "Cool down must never be left";      // NOLINT
+  EXPECT_GT(report.modeMillis[System::COOL_DOWN_MODE], 0) << "Container must be cooling down"; // NOLINT
+  EXPECT_EQ(report.overflowEvents, 0) << "Water level sensor must stop the pump in time";      // NOLINT
+  const auto passes = report.evaluatedPasses + report.skippedPasses;
+  const auto expectedPasses = Simulator::DAY_MILLIS / MainExecutor::SYSTEM_PROCESS_PERIOD;
+  EXPECT_EQ(passes, expectedPasses) << "Control loop must run on its period";                // NOLINT
+  EXPECT_LT(simulation.getModel().getWaterLevelReading(), 1) << "Container must be drained"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SimulationTest, IsWateringRepeatedlyWithCoolDownTimer) { // NOLINT
+  Simulator::Simulation simulation(Simulator::DEFAULT_TANK, 12 * Simulator::HOUR_MILLIS);
+  for (uint32_t day = 0; day < SIMULATED_DAYS; ++day) {
+    simulation.run(Simulator::DAY_MILLIS);
+  }
+  const auto &report = simulation.getReport();
+  EXPECT_EQ(report.simulatedMillis, uint64_t{SIMULATED_DAYS} * Simulator::DAY_MILLIS) << "Runs must add up"; // NOLINT
+  EXPECT_EQ(totalModeMillis(report), report.simulatedMillis) << "Every moment has a mode";                   // NOLINT
+  EXPECT_GT(report.pumpCycles, 2) << "Dry substrate must start new watering cycles";                         // NOLINT
+  EXPECT_GT(report.modeMillis[System::ACTIVE_MODE], 0) << "Cool down must be left";                          // NOLINT
+  EXPECT_EQ(report.overflowEvents, 0) << "Water level sensor must stop the pump in time";                    // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SimulationTest, IsDetectingOverflows) { // NOLINT
+  // The pump overfills the container between two sensor reads
+  const Simulator::TankParameters floodingTank = {20.0F, 100.0F, 0.02F, 0.25F, 600.0F, 86400.0F, 50.0F};
+  Simulator::Simulation simulation(floodingTank);
+  simulation.run(Simulator::HOUR_MILLIS);
+  EXPECT_EQ(simulation.getReport().overflowEvents, 1) << "Overflow must be reported";        // NOLINT
+  EXPECT_GT(simulation.getReport().spilledVolume, 0.0F) << "Spilled water must be reported"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SimulationTest, IsRunningTheDataProcess) { // NOLINT
+  Simulator::Simulation simulation;
+  simulation.run(Simulator::HOUR_MILLIS);
+  EXPECT_GT(simulation.getDataProcess().getProcessedSequence(), 0) << "Data process must see the readings"; // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <gtest/gtest.h>
+#include <simulator/tank-model/tank-model.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+// 10 litres, filled in 10 s, drained in 20 s, soaking from a quarter full
+const Simulator::TankParameters TANK = {10.0F, 1.0F, 0.5F, 0.25F, 10.0F, 100.0F, 50.0F};
+
+const uint32_t SECOND = 1000;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(TankModelTest, IsFillingAndDraining) { // NOLINT
+  Simulator::TankModel model(TANK);
+  EXPECT_FLOAT_EQ(model.getVolume(), 0.0F) << "Container must start empty"; // NOLINT
+  model.advance(SECOND);
+  EXPECT_FLOAT_EQ(model.getVolume(), 0.0F) << "Empty container must not drain below zero"; // NOLINT
+
+  model.setValveClosed(true);
+  model.setPumpOn(true);
+  model.advance(5 * SECOND);
+  EXPECT_FLOAT_EQ(model.getVolume(), 5.0F) << "Pump must fill the closed container";    // NOLINT
+  EXPECT_EQ(model.getWaterLevelReading(), 6) << "Half full container reads half scale"; // NOLINT
+
+  model.setPumpOn(false);
+  model.setValveClosed(false);
+  model.advance(4 * SECOND);
+  EXPECT_FLOAT_EQ(model.getVolume(), 3.0F) << "Open valve must drain the container"; // NOLINT
+
+  model.setPumpOn(true);
+  model.advance(2 * SECOND);
+  EXPECT_FLOAT_EQ(model.getVolume(), 4.0F) << "Pump and drain must add up"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(TankModelTest, IsCountingPumpStarts) { // NOLINT
+  Simulator::TankModel model(TANK);
+  model.setPumpOn(true);
+  model.setPumpOn(true);
+  EXPECT_TRUE(model.isPumpOn()) << "Pump must be on"; // NOLINT
+  model.setPumpOn(false);
+  model.setPumpOn(true);
+  EXPECT_EQ(model.getPumpStarts(), 2) << "Only switching the pump on counts as a start"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(TankModelTest, IsCountingOverflows) { // NOLINT
+  Simulator::TankModel model(TANK);
+  model.setValveClosed(true);
+  model.setPumpOn(true);
+  model.advance(12 * SECOND);
+  EXPECT_FLOAT_EQ(model.getVolume(), 10.0F) << "Volume must be limited to the capacity"; // NOLINT
+  EXPECT_FLOAT_EQ(model.getSpilledVolume(), 2.0F) << "Excess water must be spilled";     // NOLINT
+  const int fullScale = Simulator::WATER_LEVEL_FULL_SCALE;
+  EXPECT_EQ(model.getWaterLevelReading(), fullScale) << "Full container reads full scale"; // NOLINT
+
+  model.advance(SECOND);
+  EXPECT_EQ(model.getOverflowEvents(), 1) << "Continued overflow is a single event"; // NOLINT
+
+  model.setValveClosed(false);
+  model.setPumpOn(false);
+  model.advance(SECOND);
+  model.setValveClosed(true);
+  model.setPumpOn(true);
+  model.advance(SECOND);
+  EXPECT_EQ(model.getOverflowEvents(), 2) << "Overflow after draining is a new event"; // NOLINT
+  EXPECT_FLOAT_EQ(model.getSpilledVolume(), 3.5F) << "Spilled water must add up";      // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(TankModelTest, IsWettingAndDryingTheSubstrate) { // NOLINT
+  Simulator::TankModel model(TANK);
+  EXPECT_EQ(model.getMoistureReading(), 50) << "Moisture must start at the initial value"; // NOLINT
+  model.advance(100 * SECOND);
+  EXPECT_EQ(model.getMoistureReading(), 18) << "Substrate must dry by one time constant"; // NOLINT
+
+  model.setValveClosed(true);
+  model.setPumpOn(true);
+  model.advance(5 * SECOND);
+  model.setPumpOn(false);
+  model.advance(100 * SECOND);
+  EXPECT_EQ(model.getMoistureReading(), 99) << "Soaking substrate must saturate"; // NOLINT
+}
+
+} // namespace
+
+#endif
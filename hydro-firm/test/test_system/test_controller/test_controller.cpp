@@ -30,53 +30,107 @@
 
 #include "../../test_sensors/test_read-sensors/mock-read-sensors.hpp"
 #include "../../test_system/test_state/mock-state.hpp"
+#include <ArduinoFake.h>
 #include <gmock/gmock.h>
 #include <system/controller/controller.hpp>
-#include <tuple>
 
 #ifdef NATIVE
 
 namespace {
-
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+using ::testing::_;
 using ::testing::Exactly;
-using ::testing::Return;
 
-TEST(SystemControllerTest, IsTurnOnPumpWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};      // NOLINT(cppcoreguidelines-init-variables)
+const uint8_t PUMP_PIN = 4;
+const uint8_t VALVE_PIN = 5;
+// Pin outside of the GPIO set and clear registers
+const uint8_t UNREGISTERED_PIN = 16;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemControllerTest, IsSettingUpOutputs) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), pinMode)).AlwaysReturn();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   MockSystemState mockSystemState(mockReadSensors);
-  System::Controller controller(mockSystemState);
-  EXPECT_CALL(mockSystemState, isPumpOn()).Times(Exactly(1));
-  controller.turnOnPump();
+  System::Controller controller(mockSystemState, PUMP_PIN, UNREGISTERED_PIN);
+  controller.begin();
+  Verify(Method(ArduinoFake(), pinMode).Using(PUMP_PIN, OUTPUT)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(PUMP_PIN, LOW)).Once();
+  Verify(Method(ArduinoFake(), pinMode)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite)).Once();
 }
 
-// cppcheck-suppress [syntaxError,unmatchedSuppression]
-TEST(SystemControllerTest, IsTurnOffPumpWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};       // NOLINT(cppcoreguidelines-init-variables)
+TEST(SystemControllerTest, IsApplyingCommandsAtTheEndOfThePass) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   MockSystemState mockSystemState(mockReadSensors);
-  System::Controller controller(mockSystemState);
-  EXPECT_CALL(mockSystemState, isPumpOn()).Times(Exactly(1));
-  controller.turnOffPump();
+  System::Controller controller(mockSystemState, PUMP_PIN, VALVE_PIN);
+  EXPECT_CALL(mockSystemState, setActuators(true, true)).Times(Exactly(1));
+  controller.closeValve();
+  controller.turnOnPump();
+  Verify(Method(ArduinoFake(), digitalWrite)).Never();
+  controller.applyCommands();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(PUMP_PIN, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(VALVE_PIN, HIGH)).Once();
+  EXPECT_EQ(controller.getOutputWrites(), 1) << "Both outputs must change in one write"; // NOLINT
 }
 
-TEST(SystemControllerTest, IsCloseValveWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};      // NOLINT(cppcoreguidelines-init-variables)
+TEST(SystemControllerTest, IsCoalescingCommandsWhichCancelOut) { // NOLINT
+  ArduinoFakeReset();
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   MockSystemState mockSystemState(mockReadSensors);
-  System::Controller controller(mockSystemState);
-  EXPECT_CALL(mockSystemState, isValveClosed()).Times(Exactly(1));
+  System::Controller controller(mockSystemState, PUMP_PIN, VALVE_PIN);
+  EXPECT_CALL(mockSystemState, setActuators(_, _)).Times(Exactly(0));
+  controller.turnOnPump();
   controller.closeValve();
+  controller.turnOffPump();
+  controller.openValve();
+  controller.applyCommands();
+  controller.turnOffPump();
+  controller.applyCommands();
+  Verify(Method(ArduinoFake(), digitalWrite)).Never();
+  EXPECT_EQ(controller.getOutputWrites(), 0) << "Commands without net change must not write"; // NOLINT
 }
 
-TEST(SystemControllerTest, IsOpenValveWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};     // NOLINT(cppcoreguidelines-init-variables)
+TEST(SystemControllerTest, IsWritingOnlyChangedOutputs) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   MockSystemState mockSystemState(mockReadSensors);
-  System::Controller controller(mockSystemState);
-  EXPECT_CALL(mockSystemState, isValveClosed()).Times(Exactly(1));
-  controller.openValve();
+  System::Controller controller(mockSystemState, PUMP_PIN, VALVE_PIN);
+  EXPECT_CALL(mockSystemState, setActuators(true, true)).Times(Exactly(1));
+  EXPECT_CALL(mockSystemState, setActuators(false, true)).Times(Exactly(1));
+  controller.turnOnPump();
+  controller.closeValve();
+  controller.applyCommands();
+  ArduinoFake().ClearInvocationHistory();
+  controller.turnOffPump();
+  controller.closeValve();
+  controller.applyCommands();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(PUMP_PIN, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite)).Once();
+  EXPECT_EQ(controller.getOutputWrites(), 2) << "Each changing pass must write once"; // NOLINT
+}
+
+TEST(SystemControllerTest, IsUpdatingStateWithoutOutputs) { // NOLINT
+  ArduinoFakeReset();
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors);
+  System::State state(readSensors);
+  System::Controller controller(state);
+  controller.turnOnPump();
+  controller.closeValve();
+  controller.applyCommands();
+  Verify(Method(ArduinoFake(), digitalWrite)).Never();
+  EXPECT_TRUE(state.isPumpOn()) << "Pump must be on";           // NOLINT
+  EXPECT_TRUE(state.isValveClosed()) << "Valve must be closed"; // NOLINT
 }
 
 } // namespace
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <gtest/gtest.h>
+#include <system/decision-table/decision-table.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+/*
+ * The control logic as nested conditions, the way System::Process evaluated
+ * it before the decision table
+ */
+auto decideByConditions(const bool coolDown, const bool active, const bool wateringCycle, const bool waterLevelMax,
+                        const bool waterLevelMin, const bool moistureLevelMin) -> System::ACTION {
+  if (coolDown) {
+    return waterLevelMin ? System::CLOSE_VALVE : System::DRAIN_WATER;
+  }
+  if (active) {
+    if (waterLevelMax) {
+      return System::DRAIN_WATER;
+    }
+    if (waterLevelMin) {
+      return moistureLevelMin ? System::FILL_WATER : System::CLOSE_VALVE;
+    }
+    return wateringCycle ? System::NO_ACTION : System::CLOSE_VALVE;
+  }
+  return waterLevelMax ? System::DRAIN_WATER : System::FILL_WATER;
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(DecisionTableTest, IsMatchingConditions) { // NOLINT
+  for (uint8_t index = 0; index < System::DECISION_TABLE_SIZE; ++index) {
+    const auto mode = static_cast<System::SYSTEM_MODE>(index >> System::MODE_SHIFT);
+    const System::ACTION expected =
+        decideByConditions(mode == System::COOL_DOWN_MODE, mode == System::ACTIVE_MODE,
+                           System::hasBit(index, System::WATERING_CYCLE_BIT),
+                           System::hasBit(index, System::WATER_LEVEL_MAX_BIT),
+                           System::hasBit(index, System::WATER_LEVEL_MIN_BIT),
+                           System::hasBit(index, System::MOISTURE_LEVEL_MIN_BIT));
+    EXPECT_EQ(System::DECISION_TABLE[index], expected)           // NOLINT
+        << "Wrong action for index " << static_cast<int>(index); // NOLINT
+  }
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(DecisionTableTest, IsBuildingIndex) { // NOLINT
+  static_assert(System::decide(System::decisionIndex(System::COOL_DOWN_MODE, 0)) == System::DRAIN_WATER,
+                "Decisions must be available at compile time");
+  EXPECT_EQ(System::decisionIndex(System::FORCED_WATERING_MODE, 0), 0) << "Forced watering is mode zero"; // NOLINT
+  EXPECT_EQ(System::decisionIndex(System::COOL_DOWN_MODE, System::WATER_LEVEL_MIN_BIT),                   // NOLINT
+            (System::COOL_DOWN_MODE << System::MODE_SHIFT) | System::WATER_LEVEL_MIN_BIT)
+      << "Mode must sit above the low bits"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(DecisionTableTest, IsApplyingActions) { // NOLINT
+  const uint8_t filling = System::decisionIndex(System::ACTIVE_MODE, 0);
+  const uint8_t filled = System::applyAction(filling, System::FILL_WATER);
+  EXPECT_EQ(filled, filling | System::VALVE_CLOSED_BIT | System::PUMP_ON_BIT | System::WATERING_CYCLE_BIT) // NOLINT
+      << "Filling must close the valve and start the pump and the cycle";                                  // NOLINT
+  EXPECT_EQ(System::applyAction(filled, System::NO_ACTION), filled) << "No action keeps the state";        // NOLINT
+  EXPECT_EQ(System::applyAction(filling, System::CLOSE_VALVE), filling | System::VALVE_CLOSED_BIT)         // NOLINT
+      << "Closing the valve keeps the mode";                                                               // NOLINT
+  const uint8_t coolingDown = System::decisionIndex(System::COOL_DOWN_MODE, 0);
+  EXPECT_EQ(System::applyAction(filled, System::DRAIN_WATER), coolingDown) // NOLINT
+      << "Draining must stop the pump, open the valve and cool down";      // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <ArduinoFake.h>
+#include <gtest/gtest.h>
+#include <system/decision-table/decision-table.hpp>
+#include <system/outputs/outputs.hpp>
+
+#ifdef NATIVE
+
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemOutputsTest, IsMaskingRegisterPins) {                                                       // NOLINT
+  EXPECT_EQ(System::outputMask(0), 1U) << "GPIO0 must be in the registers";                            // NOLINT
+  EXPECT_EQ(System::outputMask(System::MAX_OUTPUT_PIN), 0x8000U) << "GPIO15 must be in the registers"; // NOLINT
+  EXPECT_EQ(System::outputMask(System::MAX_OUTPUT_PIN + 1), 0U) << "GPIO16 is not in the registers";   // NOLINT
+  EXPECT_EQ(System::outputMask(System::NO_OUTPUT_PIN), 0U) << "Unwired pin must not be driven";        // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemOutputsTest, IsSettingUpOutputsLow) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), pinMode)).AlwaysReturn();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  System::setUpOutputs(System::outputMask(4) | System::outputMask(12));
+  Verify(Method(ArduinoFake(), pinMode).Using(4, OUTPUT)).Once();
+  Verify(Method(ArduinoFake(), pinMode).Using(12, OUTPUT)).Once();
+  Verify(Method(ArduinoFake(), pinMode)).Twice();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(4, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(12, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite)).Twice();
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemOutputsTest, IsWritingOnlyChangedActuators) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  System::OutputWrite write;
+  write.addActuators(System::PUMP_ON_BIT | System::VALVE_CLOSED_BIT, System::PUMP_ON_BIT, System::outputMask(4),
+                     System::outputMask(12));
+  write.addActuators(0, System::PUMP_ON_BIT | System::VALVE_CLOSED_BIT, System::outputMask(14),
+                     System::outputMask(5));
+  write.apply();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(4, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(14, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(5, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite)).Exactly(3);
+}
+
+} // namespace
+
+#endif
@@ -28,11 +28,15 @@
  * @since: 02-10-2022
  */
 
+#include "../../test_sensors/fixed-sensor.hpp"
 #include "../../test_sensors/test_read-sensors/mock-read-sensors.hpp"
 #include "../test_controller/mock-controller.hpp"
 #include "../test_state/mock-state.hpp"
 
+#include <ArduinoFake.h>
 #include <gmock/gmock.h>
+#include <sensors/moisture-level/moisture-level.hpp>
+#include <sensors/water-level/water-level.hpp>
 #include <system/process/process.hpp>
 
 #ifdef NATIVE
@@ -43,26 +47,25 @@ using ::testing::Return;
 using ::testing::StrictMock;
 
 TEST(SystemProcessTest, InCoolDownStateAndWaterLevelMin) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};               // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isWaterLevelMin()).WillOnce(Return(true));
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .WillOnce(Return(System::decisionIndex(System::COOL_DOWN_MODE, System::WATER_LEVEL_MIN_BIT)));
   EXPECT_CALL(mockController, closeValve()).Times(Exactly(1));
   process.run();
 }
 
 // cppcheck-suppress [syntaxError,unmatchedSuppression]
 TEST(SystemProcessTest, InCoolDownStateAndWaterLevelNotMin) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                  // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isWaterLevelMin()).WillOnce(Return(false));
+  EXPECT_CALL(mockState, getDecisionIndex()).WillOnce(Return(System::decisionIndex(System::COOL_DOWN_MODE, 0)));
   EXPECT_CALL(mockController, turnOffPump()).Times(Exactly(1));
   EXPECT_CALL(mockController, openValve()).Times(Exactly(1));
   EXPECT_CALL(mockState, resetWateringCycleState()).Times(Exactly(1));
@@ -71,14 +74,13 @@ TEST(SystemProcessTest, InCoolDownStateAndWaterLevelNotMin) { // NOLINT
 }
 
 TEST(SystemProcessTest, InActiveStateAndWaterLevelMax) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};             // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isActiveState()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isWaterLevelMax()).WillOnce(Return(true));
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .WillOnce(Return(System::decisionIndex(System::ACTIVE_MODE, System::WATER_LEVEL_MAX_BIT)));
   EXPECT_CALL(mockController, turnOffPump()).Times(Exactly(1));
   EXPECT_CALL(mockController, openValve()).Times(Exactly(1));
   EXPECT_CALL(mockState, resetWateringCycleState()).Times(Exactly(1));
@@ -87,60 +89,48 @@ TEST(SystemProcessTest, InActiveStateAndWaterLevelMax) { // NOLINT
 }
 
 TEST(SystemProcessTest, InActiveStateAndWaterLevelNotMaxAndNotMinAndNotInWateringCycleState) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isActiveState()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isWaterLevelMax()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWaterLevelMin()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWateringCycleState()).WillOnce(Return(false));
+  EXPECT_CALL(mockState, getDecisionIndex()).WillOnce(Return(System::decisionIndex(System::ACTIVE_MODE, 0)));
   EXPECT_CALL(mockController, closeValve()).Times(Exactly(1));
   process.run();
 }
 
 TEST(SystemProcessTest, InActiveStateAndWaterLevelNotMaxAndNotMinAndInWateringCycleState) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isActiveState()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isWaterLevelMax()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWaterLevelMin()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWateringCycleState()).WillOnce(Return(true));
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .WillOnce(Return(System::decisionIndex(System::ACTIVE_MODE, System::WATERING_CYCLE_BIT)));
   process.run();
 }
 
 TEST(SystemProcessTest, InActiveStateAndWaterLevelMinAndMositureLevelNotMin) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isActiveState()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isWaterLevelMax()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWaterLevelMin()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isMoistureLevelMin()).WillOnce(Return(false));
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .WillOnce(Return(System::decisionIndex(System::ACTIVE_MODE, System::WATER_LEVEL_MIN_BIT)));
   EXPECT_CALL(mockController, closeValve()).Times(Exactly(1));
   process.run();
 }
 
 TEST(SystemProcessTest, InActiveStateAndWaterLevelMinAndMositureLevelMin) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                                // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isActiveState()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isWaterLevelMax()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWaterLevelMin()).WillOnce(Return(true));
-  EXPECT_CALL(mockState, isMoistureLevelMin()).WillOnce(Return(true));
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .WillOnce(Return(
+          System::decisionIndex(System::ACTIVE_MODE, System::WATER_LEVEL_MIN_BIT | System::MOISTURE_LEVEL_MIN_BIT)));
   EXPECT_CALL(mockController, closeValve()).Times(Exactly(1));
   EXPECT_CALL(mockController, turnOnPump()).Times(Exactly(1));
   EXPECT_CALL(mockState, setWateringCycleState()).Times(Exactly(1));
@@ -148,14 +138,13 @@ TEST(SystemProcessTest, InActiveStateAndWaterLevelMinAndMositureLevelMin) { // N
 }
 
 TEST(SystemProcessTest, NotActiveStateAndNotCoolDownStateAndWaterLevelMax) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                                 // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isActiveState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWaterLevelMax()).WillOnce(Return(true));
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .WillOnce(Return(System::decisionIndex(System::FORCED_WATERING_MODE, System::WATER_LEVEL_MAX_BIT)));
   EXPECT_CALL(mockController, turnOffPump()).Times(Exactly(1));
   EXPECT_CALL(mockController, openValve()).Times(Exactly(1));
   EXPECT_CALL(mockState, resetWateringCycleState()).Times(Exactly(1));
@@ -164,19 +153,131 @@ TEST(SystemProcessTest, NotActiveStateAndNotCoolDownStateAndWaterLevelMax) { //
 }
 
 TEST(SystemProcessTest, NotActiveStateAndNotCoolDownStateAndWaterLevelNotMax) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {}; // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   StrictMock<MockReadSensors> mockReadSensors(sensors);
   StrictMock<MockSystemState> mockState(mockReadSensors);
   StrictMock<MockSystemController> mockController(mockState);
   System::Process process(mockController, mockState); // NOLINT
-  EXPECT_CALL(mockState, isCoolDownState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isActiveState()).WillOnce(Return(false));
-  EXPECT_CALL(mockState, isWaterLevelMax()).WillOnce(Return(false));
+  EXPECT_CALL(mockState, getDecisionIndex()).WillOnce(Return(System::decisionIndex(System::FORCED_WATERING_MODE, 0)));
   EXPECT_CALL(mockController, turnOnPump()).Times(Exactly(1));
   EXPECT_CALL(mockController, closeValve()).Times(Exactly(1));
   EXPECT_CALL(mockState, setWateringCycleState()).Times(Exactly(1));
   process.run();
 }
 
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemProcessTest, IsSkippingPassWithoutChange) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  StrictMock<MockReadSensors> mockReadSensors(sensors);
+  StrictMock<MockSystemState> mockState(mockReadSensors);
+  StrictMock<MockSystemController> mockController(mockState);
+  System::Process process(mockController, mockState); // NOLINT
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .Times(Exactly(2))
+      .WillRepeatedly(Return(System::decisionIndex(System::COOL_DOWN_MODE, System::WATER_LEVEL_MIN_BIT)));
+  EXPECT_CALL(mockController, closeValve()).Times(Exactly(1));
+  process.run();
+  process.run();
+  EXPECT_EQ(process.getEvaluatedPasses(), 1) << "First pass must be evaluated"; // NOLINT
+  EXPECT_EQ(process.getSkippedPasses(), 1) << "Unchanged pass must be skipped"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemProcessTest, IsEvaluatingOnChangedDecisionIndex) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors);
+  StrictMock<MockSystemState> mockState(readSensors);
+  StrictMock<MockSystemController> mockController(mockState);
+  System::Process process(mockController, mockState); // NOLINT
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .WillOnce(Return(System::decisionIndex(System::COOL_DOWN_MODE, System::WATER_LEVEL_MIN_BIT)))
+      .WillOnce(Return(
+          System::decisionIndex(System::COOL_DOWN_MODE, System::WATER_LEVEL_MIN_BIT | System::MOISTURE_LEVEL_MIN_BIT)));
+  EXPECT_CALL(mockController, closeValve()).Times(Exactly(2));
+  process.run();
+  process.run();
+  EXPECT_EQ(process.getEvaluatedPasses(), 2) << "Pass with a new threshold bit must be evaluated"; // NOLINT
+  EXPECT_EQ(process.getSkippedPasses(), 0) << "No pass must be skipped";                           // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemProcessTest, IsSkippingRepublishedReadings) { // NOLINT
+  const int waterLevel = 5;
+  const int moistureLevel = 50;
+  const uint32_t passCount = 100;
+  FixedSensor waterLevelSensor(Sensors::WATER_LEVEL_SENSOR, waterLevel);
+  FixedSensor moistureLevelSensor(Sensors::MOISTURE_LEVEL_SENSOR, moistureLevel);
+  Sensors::SensorSet<2> sensors = {&waterLevelSensor, &moistureLevelSensor};
+  Sensors::ReadSensors readSensors(sensors);
+  System::State state(readSensors);
+  System::Controller controller(state);
+  System::Process process(controller, state); // NOLINT
+  for (uint32_t pass = 0; pass < passCount; ++pass) {
+    readSensors.readAllSensors();
+    process.run();
+  }
+  EXPECT_EQ(readSensors.getSequence(), passCount) << "Every read must publish a snapshot";          // NOLINT
+  EXPECT_LE(process.getEvaluatedPasses(), 3) << "Only passes changing the state must be evaluated"; // NOLINT
+  EXPECT_EQ(process.getEvaluatedPasses() + process.getSkippedPasses(), passCount) << "Passes lost"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemProcessTest, IsEvaluatingOnStateChange) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors);
+  System::State state(readSensors);
+  System::Controller controller(state);
+  System::Process process(controller, state); // NOLINT
+  process.run();
+  EXPECT_TRUE(state.isWateringCycleState()) << "Watering cycle must be started";                    // NOLINT
+  process.run();
+  process.run();
+  EXPECT_EQ(process.getEvaluatedPasses(), 2) << "Pass after a state change must be evaluated"; // NOLINT
+  EXPECT_EQ(process.getSkippedPasses(), 1) << "Settled pass must be skipped";                  // NOLINT
+  state.resetCoolDownState();
+  process.run();
+  EXPECT_EQ(process.getEvaluatedPasses(), 3) << "Outside state change must be evaluated"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemProcessTest, IsCallingMocksByStaticType) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  StrictMock<MockReadSensors> mockReadSensors(sensors);
+  StrictMock<MockSystemState> mockState(mockReadSensors);
+  StrictMock<MockSystemController> mockController(mockState);
+  System::BasicProcess<StrictMock<MockSystemController>, StrictMock<MockSystemState>> process(mockController,
+                                                                                            mockState);
+  EXPECT_CALL(mockState, getDecisionIndex())
+      .Times(Exactly(2))
+      .WillRepeatedly(Return(
+          System::decisionIndex(System::ACTIVE_MODE, System::WATER_LEVEL_MIN_BIT | System::MOISTURE_LEVEL_MIN_BIT)));
+  EXPECT_CALL(mockController, closeValve()).Times(Exactly(1));
+  EXPECT_CALL(mockController, turnOnPump()).Times(Exactly(1));
+  EXPECT_CALL(mockState, setWateringCycleState()).Times(Exactly(1));
+  process.run();
+  process.run();
+  EXPECT_EQ(process.getSkippedPasses(), 1) << "Unchanged pass must be skipped"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemProcessTest, IsApplyingCommandsOnceAtTheEndOfThePass) { // NOLINT
+  const uint8_t pumpPin = 4;
+  const uint8_t valvePin = 5;
+  ArduinoFakeReset();
+  fakeit::When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+  Sensors::SensorSet<1> sensors;
+  Sensors::ReadSensors readSensors(sensors);
+  System::State state(readSensors);
+  System::Controller controller(state, pumpPin, valvePin);
+  System::Process process(controller, state); // NOLINT
+  process.run();
+  fakeit::Verify(Method(ArduinoFake(), digitalWrite).Using(pumpPin, HIGH)).Once();
+  fakeit::Verify(Method(ArduinoFake(), digitalWrite).Using(valvePin, HIGH)).Once();
+  EXPECT_EQ(controller.getOutputWrites(), 1) << "Filling must write the outputs once";       // NOLINT
+  EXPECT_TRUE(state.isPumpOn() && state.isValveClosed()) << "State must follow the outputs"; // NOLINT
+  process.run();
+  EXPECT_EQ(controller.getOutputWrites(), 1) << "Repeated commands must not write";   // NOLINT
+}
+
 } // namespace
 #endif
\ No newline at end of file
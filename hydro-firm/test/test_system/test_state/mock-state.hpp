@@ -62,6 +62,8 @@ public:
   // NOLINTNEXTLINE(modernize-use-trailing-return-type)
   MOCK_METHOD(bool, isValveClosed, (), (const, override));
   // NOLINTNEXTLINE(modernize-use-trailing-return-type)
+  MOCK_METHOD(void, setActuators, (bool pumpOn, bool valveClosed), (override));
+  // NOLINTNEXTLINE(modernize-use-trailing-return-type)
   MOCK_METHOD(void, setWateringCycleState, (), (override));
   // NOLINTNEXTLINE(modernize-use-trailing-return-type)
   MOCK_METHOD(void, resetWateringCycleState, (), (override));
@@ -73,6 +75,8 @@ public:
   MOCK_METHOD(void, setActiveState, (), (override));
   // NOLINTNEXTLINE(modernize-use-trailing-return-type)
   MOCK_METHOD(void, resetActiveState, (), (override));
+  // NOLINTNEXTLINE(modernize-use-trailing-return-type)
+  MOCK_METHOD(uint8_t, getDecisionIndex, (), (override));
 };
 
 #endif
\ No newline at end of file
@@ -39,6 +39,9 @@
 
 namespace {
 
+const uint8_t READ_PIN = 1;
+const uint8_t POWER_PIN = 2;
+
 using ::testing::_;
 using ::testing::Exactly;
 using ::testing::Return;
@@ -56,10 +59,13 @@ INSTANTIATE_TEST_SUITE_P(WaterLevelValues, SystemStateWaterLevelMaxTest,
 
 // cppcheck-suppress [syntaxError,unmatchedSuppression]
 TEST_P(SystemStateWaterLevelMaxTest, IsWaterLevelMax) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};            // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::MoistureLevelSensor moistureLevelSensor(READ_PIN, POWER_PIN);
+  Sensors::WaterLevelSensor waterLevelSensor(READ_PIN, POWER_PIN);
+  Sensors::SensorSet<2> sensors = {&moistureLevelSensor, &waterLevelSensor};
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
-  EXPECT_CALL(mockReadSensors, getSensorReading(Sensors::WATER_LEVEL_SENSOR)).WillOnce(Return(std::get<0>(GetParam())));
+  EXPECT_CALL(mockReadSensors, getSensorReadingById(waterLevelSensor.getId()))
+      .WillOnce(Return(std::get<0>(GetParam())));
   EXPECT_EQ(state.isWaterLevelMax(), std::get<1>(GetParam())) << "Wrong water level max status"; // NOLINT
 }
 
@@ -75,10 +81,13 @@ INSTANTIATE_TEST_SUITE_P(WaterLevelValues, SystemStateWaterLevelMinTest,
                                          std::make_tuple(System::WATER_LEVEL_MIN_ALLOWED - 1, true)));
 
 TEST_P(SystemStateWaterLevelMinTest, IsWaterLevelMin) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};            // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::MoistureLevelSensor moistureLevelSensor(READ_PIN, POWER_PIN);
+  Sensors::WaterLevelSensor waterLevelSensor(READ_PIN, POWER_PIN);
+  Sensors::SensorSet<2> sensors = {&moistureLevelSensor, &waterLevelSensor};
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
-  EXPECT_CALL(mockReadSensors, getSensorReading(Sensors::WATER_LEVEL_SENSOR)).WillOnce(Return(std::get<0>(GetParam())));
+  EXPECT_CALL(mockReadSensors, getSensorReadingById(waterLevelSensor.getId()))
+      .WillOnce(Return(std::get<0>(GetParam())));
   EXPECT_EQ(state.isWaterLevelMin(), std::get<1>(GetParam())) << "Wrong water level min status"; // NOLINT
 }
 
@@ -91,16 +100,18 @@ INSTANTIATE_TEST_SUITE_P(WaterLevelValues, SystemStateMoistureLevelMinTest,
                                          std::make_tuple(System::MOISTURE_LEVEL_MIN_ALLOWED - 1, true)));
 
 TEST_P(SystemStateMoistureLevelMinTest, IsMoistureLevelMin) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                  // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::MoistureLevelSensor moistureLevelSensor(READ_PIN, POWER_PIN);
+  Sensors::WaterLevelSensor waterLevelSensor(READ_PIN, POWER_PIN);
+  Sensors::SensorSet<2> sensors = {&moistureLevelSensor, &waterLevelSensor};
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
-  EXPECT_CALL(mockReadSensors, getSensorReading(Sensors::MOISTURE_LEVEL_SENSOR))
+  EXPECT_CALL(mockReadSensors, getSensorReadingById(moistureLevelSensor.getId()))
       .WillOnce(Return(std::get<0>(GetParam())));
   EXPECT_EQ(state.isMoistureLevelMin(), std::get<1>(GetParam())) << "Wrong moisture level min status"; // NOLINT
 }
 
 TEST(SystemStateCoolDownStateTest, IsSetCoolDownStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                    // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.setCoolDownState();
@@ -108,7 +119,7 @@ TEST(SystemStateCoolDownStateTest, IsSetCoolDownStateWorking) { // NOLINT
 }
 
 TEST(SystemStateCoolDownStateTest, IsResetCoolDownStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                      // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.resetCoolDownState();
@@ -117,7 +128,7 @@ TEST(SystemStateCoolDownStateTest, IsResetCoolDownStateWorking) { // NOLINT
 }
 
 TEST(SystemStateActiveStateTest, IsSetActiveStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.setActiveState();
@@ -125,7 +136,7 @@ TEST(SystemStateActiveStateTest, IsSetActiveStateWorking) { // NOLINT
 }
 
 TEST(SystemStateActiveStateTest, IsResetActiveStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                  // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.resetActiveState();
@@ -134,7 +145,7 @@ TEST(SystemStateActiveStateTest, IsResetActiveStateWorking) { // NOLINT
 }
 
 TEST(SystemStateWateringCycleStateTest, IsSetWateringCycleStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                              // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.setWateringCycleState();
@@ -142,7 +153,7 @@ TEST(SystemStateWateringCycleStateTest, IsSetWateringCycleStateWorking) { // NOL
 }
 
 TEST(SystemStateCoolDownStateTest, IsResetWateringCycleStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                           // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.resetWateringCycleState();
@@ -155,7 +166,7 @@ class SystemStatePumpStateTest : public testing::TestWithParam<bool> {};
 INSTANTIATE_TEST_SUITE_P(PumpValues, SystemStatePumpStateTest, testing::Values(true, false));
 
 TEST_P(SystemStatePumpStateTest, IsSetPumpStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};              // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.setPumpOn(GetParam());
@@ -168,12 +179,52 @@ class SystemStateValveStateTest : public testing::TestWithParam<bool> {};
 INSTANTIATE_TEST_SUITE_P(ValveValues, SystemStateValveStateTest, testing::Values(true, false));
 
 TEST_P(SystemStateValveStateTest, IsSetValveStateWorking) { // NOLINT
-  std::list<Sensors::Sensor *> sensors = {};                // NOLINT(cppcoreguidelines-init-variables)
+  Sensors::SensorSet<1> sensors;
   MockReadSensors mockReadSensors(sensors);
   System::State state(mockReadSensors);
   state.setValveClosed(GetParam());
   EXPECT_EQ(state.isValveClosed(), GetParam()) << "Wrong value for valve state"; // NOLINT
 }
 
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemStateWordTest, IsPackingFlags) { // NOLINT
+  Sensors::SensorSet<1> sensors;
+  MockReadSensors mockReadSensors(sensors);
+  System::State state(mockReadSensors);
+  EXPECT_EQ(state.getMode(), System::FORCED_WATERING_MODE) << "System must start by forcing watering"; // NOLINT
+  state.setActiveState();
+  state.setWateringCycleState();
+  state.setPumpOn(true);
+  state.setValveClosed(true);
+  EXPECT_EQ(state.getStateWord(), System::decisionIndex(System::ACTIVE_MODE, System::WATERING_CYCLE_BIT) | // NOLINT
+                                      System::PUMP_ON_BIT | System::VALVE_CLOSED_BIT)
+      << "Flags must be packed into the state word"; // NOLINT
+  state.setCoolDownState();
+  EXPECT_FALSE(state.isActiveState()) << "Modes must exclude each other";                // NOLINT
+  EXPECT_TRUE(state.isWateringCycleState()) << "Mode change must keep the other flags"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(SystemStateWordTest, IsBuildingDecisionIndex) { // NOLINT
+  Sensors::MoistureLevelSensor moistureLevelSensor(1, 1);
+  Sensors::WaterLevelSensor waterLevelSensor(1, 1);
+  Sensors::SensorSet<2> sensors = {&moistureLevelSensor, &waterLevelSensor};
+  MockReadSensors mockReadSensors(sensors);
+  System::State state(mockReadSensors);
+  state.setCoolDownState();
+  state.setPumpOn(true);
+  EXPECT_CALL(mockReadSensors, getSensorReadingById(waterLevelSensor.getId()))
+      .WillOnce(Return(System::WATER_LEVEL_MAX_ALLOWED))
+      .WillOnce(Return(System::WATER_LEVEL_MIN_ALLOWED));
+  EXPECT_CALL(mockReadSensors, getSensorReadingById(moistureLevelSensor.getId()))
+      .WillOnce(Return(System::MOISTURE_LEVEL_MIN_ALLOWED + 1))
+      .WillOnce(Return(System::MOISTURE_LEVEL_MIN_ALLOWED));
+  const uint8_t fullIndex = System::decisionIndex(System::COOL_DOWN_MODE, System::WATER_LEVEL_MAX_BIT);
+  const uint8_t emptyIndex =
+      System::decisionIndex(System::COOL_DOWN_MODE, System::WATER_LEVEL_MIN_BIT | System::MOISTURE_LEVEL_MIN_BIT);
+  EXPECT_EQ(state.getDecisionIndex(), fullIndex) << "Full container must set the maximum bit";       // NOLINT
+  EXPECT_EQ(state.getDecisionIndex(), emptyIndex) << "Empty container and dry plants set minimum bits"; // NOLINT
+}
+
 } // namespace
 #endif
\ No newline at end of file
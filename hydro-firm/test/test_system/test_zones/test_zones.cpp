@@ -0,0 +1,191 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include "../../test_sensors/mock-sensors.hpp"
+#include <ArduinoFake.h>
+#include <gmock/gmock.h>
+#include <sensors/read-sensors/read-sensors.hpp>
+#include <sensors/sensor-set/sensor-set.hpp>
+#include <system/state/state.hpp>
+#include <system/zones/zones.hpp>
+
+#ifdef NATIVE
+
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+using ::testing::Return;
+
+const int FULL = System::WATER_LEVEL_MAX_ALLOWED;
+const int EMPTY = System::WATER_LEVEL_MIN_ALLOWED;
+const int HALF = (FULL + EMPTY) / 2;
+const int DRY = System::MOISTURE_LEVEL_MIN_ALLOWED;
+const int WET = DRY + 50;
+
+/*
+ * Two zones, each with a water level and a moisture sensor whose readings
+ * the test sets
+ */
+class ZonesTest : public ::testing::Test {
+protected:
+  MockSensor firstWaterLevel{"Water 1", 1, 0};
+  MockSensor firstMoistureLevel{"Moisture 1", 2, 0};
+  MockSensor secondWaterLevel{"Water 2", 3, 0};
+  MockSensor secondMoistureLevel{"Moisture 2", 4, 0};
+  Sensors::SensorSet<4> sensors{&firstWaterLevel, &firstMoistureLevel, &secondWaterLevel, &secondMoistureLevel};
+  Sensors::ReadSensors readSensors{sensors};
+  System::Zones zones{readSensors};
+
+  void SetUp() override {
+    ArduinoFakeReset();
+    When(Method(ArduinoFake(), pinMode)).AlwaysReturn();
+    When(Method(ArduinoFake(), digitalWrite)).AlwaysReturn();
+    zones.addZone({firstWaterLevel.getId(), firstMoistureLevel.getId(), 10, 11});
+    zones.addZone({secondWaterLevel.getId(), secondMoistureLevel.getId(), 12, 13});
+  }
+
+  /*
+   * Publish a read cycle with the given readings
+   */
+  void read(const int firstWater, const int firstMoisture, const int secondWater, const int secondMoisture) {
+    EXPECT_CALL(firstWaterLevel, readSensor());
+    EXPECT_CALL(firstMoistureLevel, readSensor());
+    EXPECT_CALL(secondWaterLevel, readSensor());
+    EXPECT_CALL(secondMoistureLevel, readSensor());
+    EXPECT_CALL(firstWaterLevel, getReading()).WillOnce(Return(firstWater));
+    EXPECT_CALL(firstMoistureLevel, getReading()).WillOnce(Return(firstMoisture));
+    EXPECT_CALL(secondWaterLevel, getReading()).WillOnce(Return(secondWater));
+    EXPECT_CALL(secondMoistureLevel, getReading()).WillOnce(Return(secondMoisture));
+    readSensors.readAllSensors();
+  }
+};
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(ZonesTest, IsSettingUpOutputs) {                             // NOLINT
+  EXPECT_EQ(zones.getZoneCount(), 2) << "Both zones must be added"; // NOLINT
+  Verify(Method(ArduinoFake(), pinMode).Using(10, OUTPUT)).Once();
+  Verify(Method(ArduinoFake(), pinMode).Using(13, OUTPUT)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(12, LOW)).Once();
+  EXPECT_EQ(zones.getMode(1), System::FORCED_WATERING_MODE) << "Zones start by watering"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(ZonesTest, AreZonesIndependent) { // NOLINT
+  read(HALF, WET, FULL, WET);
+  zones.run();
+  EXPECT_EQ(zones.getStateWord(0), System::applyAction(0, System::FILL_WATER)) << "First zone must fill"; // NOLINT
+  EXPECT_EQ(zones.getMode(1), System::COOL_DOWN_MODE) << "Full second zone must drain";                   // NOLINT
+  Verify(Method(ArduinoFake(), digitalWrite).Using(10, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(11, HIGH)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(12, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(13, LOW)).Once();
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(ZonesTest, IsWritingOnlyChangedOutputs) { // NOLINT
+  read(HALF, WET, HALF, WET);
+  zones.run();
+  ArduinoFake().ClearInvocationHistory();
+  read(HALF, WET, FULL, WET);
+  zones.run();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(10, HIGH)).Never();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(12, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite).Using(13, LOW)).Once();
+  Verify(Method(ArduinoFake(), digitalWrite)).Twice();
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(ZonesTest, IsSkippingUnchangedPasses) { // NOLINT
+  read(HALF, WET, HALF, WET);
+  zones.run();
+  zones.run();
+  zones.run();
+  EXPECT_EQ(zones.getEvaluatedPasses(), 2) << "Changing pass must be followed by one more"; // NOLINT
+  EXPECT_EQ(zones.getSkippedPasses(), 1) << "Unchanged pass must be skipped";               // NOLINT
+
+  read(FULL, WET, FULL, WET);
+  zones.run();
+  EXPECT_EQ(zones.getMode(0), System::COOL_DOWN_MODE) << "Full zone must cool down"; // NOLINT
+  zones.resetCoolDown(0);
+  zones.resetCoolDown(0);
+  EXPECT_EQ(zones.getMode(0), System::ACTIVE_MODE) << "Reset must leave cool down"; // NOLINT
+  zones.run();
+  EXPECT_EQ(zones.getEvaluatedPasses(), 4) << "Reset must be evaluated";                     // NOLINT
+  EXPECT_EQ(zones.getMode(0), System::COOL_DOWN_MODE) << "Still full zone must drain again"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(ZonesTest, IsSkippingRepublishedReadings) { // NOLINT
+  read(HALF, WET, HALF, WET);
+  zones.run();
+  zones.run();
+  ArduinoFake().ClearInvocationHistory();
+  read(HALF, WET, HALF, WET);
+  zones.run();
+  read(HALF, WET, HALF, WET);
+  zones.run();
+  EXPECT_EQ(zones.getEvaluatedPasses(), 2) << "Republished readings must not be evaluated"; // NOLINT
+  EXPECT_EQ(zones.getSkippedPasses(), 2) << "Republished readings must be skipped";         // NOLINT
+  Verify(Method(ArduinoFake(), digitalWrite)).Never();
+
+  read(HALF, DRY, HALF, WET);
+  zones.run();
+  EXPECT_EQ(zones.getEvaluatedPasses(), 3) << "Changed reading must be evaluated"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(ZonesTest, IsWateringDryZoneInActiveMode) { // NOLINT
+  read(FULL, WET, FULL, WET);
+  zones.run();
+  read(EMPTY, DRY, EMPTY, WET);
+  zones.run();
+  zones.resetCoolDown(0);
+  zones.resetCoolDown(1);
+  zones.run();
+  EXPECT_TRUE(System::hasBit(zones.getStateWord(0), System::PUMP_ON_BIT)) << "Dry zone must be watered"; // NOLINT
+  EXPECT_FALSE(System::hasBit(zones.getStateWord(1), System::PUMP_ON_BIT)) << "Wet zone must wait";      // NOLINT
+  EXPECT_TRUE(System::hasBit(zones.getStateWord(1), System::VALVE_CLOSED_BIT)) << "Valve must close";    // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST_F(ZonesTest, AreZonesBounded) { // NOLINT
+  const System::ZoneBinding unwired = {0, 1, System::NO_OUTPUT_PIN, System::NO_OUTPUT_PIN};
+  for (uint8_t zone = zones.getZoneCount(); zone < System::MAX_ZONES; ++zone) {
+    EXPECT_EQ(zones.addZone(unwired), zone) << "Zone must be added"; // NOLINT
+  }
+  Verify(Method(ArduinoFake(), pinMode)).Exactly(4);
+  EXPECT_EQ(zones.addZone(unwired), System::INVALID_ZONE_ID) << "Zone beyond capacity"; // NOLINT
+  read(HALF, WET, HALF, WET);
+  zones.run();
+  EXPECT_EQ(zones.getStateWord(System::MAX_ZONES - 1), zones.getStateWord(0)) << "Last zone must run"; // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <telemetry/loopback/loopback.hpp>
+#include <vector>
+
+#ifdef NATIVE
+
+namespace {
+
+const std::array<uint8_t, 3> BATCH = {'a', 'b', 'c'};
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(LoopbackTransportTest, IsReceivingBatchesInOrder) { // NOLINT
+  Telemetry::LoopbackTransport transport;
+  std::vector<uint8_t> batch;
+  EXPECT_FALSE(transport.receive(batch)) << "Empty queue must not yield a batch"; // NOLINT
+
+  EXPECT_TRUE(transport.send(BATCH.data(), BATCH.size())) << "Batch must be accepted";  // NOLINT
+  EXPECT_TRUE(transport.send(BATCH.data(), 1)) << "Second batch must be accepted";      // NOLINT
+  EXPECT_EQ(transport.getQueuedBatches(), 2) << "Both batches must be queued";          // NOLINT
+  EXPECT_EQ(transport.getReceivedBatches(), 2) << "Both batches must be counted";       // NOLINT
+  EXPECT_EQ(transport.getReceivedBytes(), BATCH.size() + 1) << "Bytes must be counted"; // NOLINT
+
+  EXPECT_TRUE(transport.receive(batch)) << "Queued batch must be received";                         // NOLINT
+  EXPECT_EQ(batch, std::vector<uint8_t>(BATCH.begin(), BATCH.end())) << "Oldest batch comes first"; // NOLINT
+  EXPECT_TRUE(transport.receive(batch)) << "Queued batch must be received";                         // NOLINT
+  EXPECT_EQ(batch, std::vector<uint8_t>(1, 'a')) << "Newest batch comes last";                      // NOLINT
+  EXPECT_EQ(transport.getQueuedBatches(), 0) << "Queue must be drained";                            // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(LoopbackTransportTest, IsApplyingBackpressure) { // NOLINT
+  Telemetry::LoopbackTransport transport(1);
+  std::vector<uint8_t> batch;
+  EXPECT_TRUE(transport.send(BATCH.data(), BATCH.size())) << "Batch must be accepted";  // NOLINT
+  EXPECT_FALSE(transport.isReady()) << "Full queue must not be ready";                  // NOLINT
+  EXPECT_FALSE(transport.send(BATCH.data(), BATCH.size())) << "Full queue must reject"; // NOLINT
+  EXPECT_EQ(transport.getRejectedBatches(), 1) << "Rejected batch must be counted";     // NOLINT
+  EXPECT_TRUE(transport.receive(batch)) << "Queued batch must be received";             // NOLINT
+  EXPECT_TRUE(transport.isReady()) << "Drained queue must be ready again";              // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(LoopbackTransportTest, IsRejectingWhileDisconnected) { // NOLINT
+  Telemetry::LoopbackTransport transport;
+  transport.setConnected(false);
+  EXPECT_FALSE(transport.isReady()) << "Disconnected link must not be ready";           // NOLINT
+  EXPECT_FALSE(transport.send(BATCH.data(), BATCH.size())) << "Batch must be rejected"; // NOLINT
+  transport.setConnected(true);
+  EXPECT_TRUE(transport.send(BATCH.data(), BATCH.size())) << "Batch must be accepted"; // NOLINT
+  EXPECT_EQ(transport.getRejectedBatches(), 1) << "Rejected batch must be counted";    // NOLINT
+}
+
+} // namespace
+
+#endif
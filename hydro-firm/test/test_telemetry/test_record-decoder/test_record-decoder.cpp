@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <algorithm>
+#include <array>
+#include <gtest/gtest.h>
+#include <telemetry/record-decoder/record-decoder.hpp>
+#include <telemetry/record-format/record-format.hpp>
+#include <vector>
+
+#ifdef NATIVE
+
+namespace {
+
+const Sensors::SENSOR_ID UNTRACKED_SENSOR_ID = 200;
+
+const std::vector<Telemetry::Record> RECORDS = {
+    {0, 1000, 523},      {1, 1000, -7},       {0, 2000, INT32_MIN},           {1, 500, INT32_MAX},
+    {0, UINT32_MAX, 0},  {1, 3, 9},           {UNTRACKED_SENSOR_ID, 3, 42},   {UNTRACKED_SENSOR_ID, 3, -42},
+};
+
+/*
+ * Encode the records into one batch
+ */
+auto encode(const std::vector<Telemetry::Record> &records) -> std::vector<uint8_t> {
+  std::vector<uint8_t> batch(Telemetry::RECORD_HEADER_SIZE + records.size() * Telemetry::MAX_RECORD_SIZE);
+  Telemetry::RecordEncoder encoder(batch.data(), batch.size());
+  for (const Telemetry::Record &record : records) {
+    encoder.append(record.sensorId, record.timestamp, record.value);
+  }
+  batch.resize(encoder.finish());
+  return batch;
+}
+
+/*
+ * Feed the stream in chunks of the given size, collecting the records and
+ * counting the errors
+ */
+auto decode(Telemetry::RecordDecoder &decoder, const std::vector<uint8_t> &stream, const size_t chunkSize)
+    -> std::vector<Telemetry::Record> {
+  std::vector<Telemetry::Record> records;
+  Telemetry::Record record = {};
+  for (size_t chunk = 0; chunk < stream.size(); chunk += chunkSize) {
+    const size_t end = std::min(stream.size(), chunk + chunkSize);
+    size_t offset = chunk;
+    while (offset < end) {
+      size_t consumed = 0;
+      if (decoder.next(&stream[offset], end - offset, record, consumed) == Telemetry::DECODE_RECORD) {
+        records.push_back(record);
+      }
+      offset += consumed;
+    }
+  }
+  return records;
+}
+
+/*
+ * Compare decoded records with the expected ones
+ */
+void expectRecords(const std::vector<Telemetry::Record> &actual, const std::vector<Telemetry::Record> &expected) {
+  ASSERT_EQ(actual.size(), expected.size()) << "Every record must be decoded"; // NOLINT
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(actual[i].sensorId, expected[i].sensorId) << "Sensor of record " << i;      // NOLINT
+    EXPECT_EQ(actual[i].timestamp, expected[i].timestamp) << "Timestamp of record " << i; // NOLINT
+    EXPECT_EQ(actual[i].value, expected[i].value) << "Value of record " << i;             // NOLINT
+  }
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordDecoderTest, IsDecodingWholeBatch) { // NOLINT
+  Telemetry::RecordDecoder decoder;
+  const std::vector<uint8_t> batch = encode(RECORDS);
+  expectRecords(decode(decoder, batch, batch.size()), RECORDS);
+  EXPECT_EQ(decoder.getDecodedBatches(), 1) << "Batch must be counted"; // NOLINT
+  EXPECT_EQ(decoder.getErrors(), 0) << "Valid batch has no errors";     // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordDecoderTest, IsDecodingBytewise) { // NOLINT
+  Telemetry::RecordDecoder decoder;
+  const std::vector<uint8_t> batch = encode(RECORDS);
+  Telemetry::Record record = {};
+  size_t consumed = 0;
+  EXPECT_EQ(decoder.next(batch.data(), 1, record, consumed), Telemetry::DECODE_NEED_MORE) // NOLINT
+      << "Partial header needs more";                                                     // NOLINT
+  EXPECT_EQ(consumed, 1) << "Partial input must be consumed";                             // NOLINT
+  expectRecords(decode(decoder, std::vector<uint8_t>(batch.begin() + 1, batch.end()), 1), RECORDS);
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordDecoderTest, IsDecodingStreamOfBatches) { // NOLINT
+  Telemetry::RecordDecoder decoder;
+  std::vector<uint8_t> stream = encode(RECORDS);
+  const std::vector<uint8_t> empty = encode({});
+  const std::vector<uint8_t> second = encode({RECORDS[1]});
+  stream.insert(stream.end(), empty.begin(), empty.end());
+  stream.insert(stream.end(), second.begin(), second.end());
+  std::vector<Telemetry::Record> expected = RECORDS;
+  expected.push_back(RECORDS[1]);
+  expectRecords(decode(decoder, stream, 7), expected);
+  EXPECT_EQ(decoder.getDecodedBatches(), 3) << "Every batch must be counted"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordDecoderTest, IsResynchronisingAfterBadHeader) { // NOLINT
+  Telemetry::RecordDecoder decoder;
+  std::vector<uint8_t> badVersion = encode(RECORDS);
+  badVersion[1] = Telemetry::RECORD_FORMAT_VERSION + 1;
+  std::vector<uint8_t> stream = {0x00};
+  stream.insert(stream.end(), badVersion.begin(), badVersion.begin() + Telemetry::RECORD_HEADER_SIZE);
+  const std::vector<uint8_t> batch = encode(RECORDS);
+  stream.insert(stream.end(), batch.begin(), batch.end());
+  expectRecords(decode(decoder, stream, stream.size()), RECORDS);
+  EXPECT_EQ(decoder.getErrors(), 2) << "Stray byte and bad version must be errors"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordDecoderTest, IsRejectingWrongPayloadLength) { // NOLINT
+  std::vector<uint8_t> shorter = encode({RECORDS[0]});
+  --shorter[Telemetry::RECORD_LENGTH_OFFSET];
+  Telemetry::RecordDecoder shorterDecoder;
+  EXPECT_TRUE(decode(shorterDecoder, shorter, shorter.size()).empty()) << "Truncated record is dropped"; // NOLINT
+  EXPECT_EQ(shorterDecoder.getErrors(), 1) << "Short payload must be an error";                          // NOLINT
+
+  std::vector<uint8_t> longer = encode({RECORDS[0]});
+  ++longer[Telemetry::RECORD_LENGTH_OFFSET];
+  longer.push_back(0);
+  Telemetry::RecordDecoder longerDecoder;
+  EXPECT_TRUE(decode(longerDecoder, longer, longer.size()).empty()) << "Batch with extra bytes is dropped"; // NOLINT
+  EXPECT_EQ(longerDecoder.getErrors(), 2) << "Long payload and stray byte must be errors";                  // NOLINT
+
+  std::vector<uint8_t> empty = encode({});
+  ++empty[Telemetry::RECORD_LENGTH_OFFSET];
+  Telemetry::RecordDecoder emptyDecoder;
+  decode(emptyDecoder, empty, empty.size());
+  EXPECT_EQ(emptyDecoder.getErrors(), 1) << "Empty batch with payload must be an error"; // NOLINT
+  EXPECT_EQ(emptyDecoder.getDecodedBatches(), 0) << "Bad batch must not be counted";     // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordDecoderTest, IsRejectingOverlongVarint) { // NOLINT
+  std::vector<uint8_t> batch = encode({});
+  batch[Telemetry::RECORD_COUNT_OFFSET] = 1;
+  batch[Telemetry::RECORD_LENGTH_OFFSET] = 7;
+  const std::vector<uint8_t> record = {0, 0x80, 0x80, 0x80, 0x80, 0x10, 0};
+  batch.insert(batch.end(), record.begin(), record.end());
+  Telemetry::RecordDecoder decoder;
+  EXPECT_TRUE(decode(decoder, batch, batch.size()).empty()) << "Overlong varint is dropped"; // NOLINT
+  EXPECT_GE(decoder.getErrors(), 1) << "Overlong varint must be an error";                   // NOLINT
+}
+
+} // namespace
+
+#endif
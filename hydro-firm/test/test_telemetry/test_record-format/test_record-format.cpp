@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <telemetry/record-format/record-format.hpp>
+#include <vector>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t TIMESTAMP = 1000;
+const Sensors::SENSOR_ID UNTRACKED_SENSOR_ID = 200;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordFormatTest, IsWritingVarints) { // NOLINT
+  std::array<uint8_t, Telemetry::MAX_VARINT_SIZE> output = {};
+  EXPECT_EQ(Telemetry::writeVarint(0, output.data()), 1) << "Zero must take one byte";      // NOLINT
+  EXPECT_EQ(output[0], 0) << "Zero must be written as is";                                  // NOLINT
+  EXPECT_EQ(Telemetry::writeVarint(127, output.data()), 1) << "7 bits must take one byte";  // NOLINT
+  EXPECT_EQ(Telemetry::writeVarint(128, output.data()), 2) << "8 bits must take two bytes"; // NOLINT
+  EXPECT_EQ(output[0], 0x80) << "Lowest group must come first";                             // NOLINT
+  EXPECT_EQ(output[1], 0x01) << "Last byte must not continue";                              // NOLINT
+  EXPECT_EQ(Telemetry::writeVarint(UINT32_MAX, output.data()), Telemetry::MAX_VARINT_SIZE)
+      << "32 bits must take five bytes";                                  // NOLINT
+  EXPECT_EQ(output[4], 0x0F) << "Last byte must hold the highest 4 bits"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordFormatTest, IsEncodingBatch) { // NOLINT
+  std::array<uint8_t, Telemetry::RECORD_HEADER_SIZE + 2 * Telemetry::MAX_RECORD_SIZE> buffer = {};
+  Telemetry::RecordEncoder encoder(buffer.data(), buffer.size());
+  EXPECT_TRUE(encoder.append(1, TIMESTAMP, 523)) << "Reading must fit";                              // NOLINT
+  EXPECT_TRUE(encoder.append(1, 2 * TIMESTAMP, 520)) << "Reading must fit";                          // NOLINT
+  EXPECT_EQ(encoder.getRecordCount(), 2) << "Both readings must be counted";                         // NOLINT
+  EXPECT_EQ(encoder.finish(), Telemetry::RECORD_HEADER_SIZE + 8) << "Batch length must be returned"; // NOLINT
+
+  const std::vector<uint8_t> expected = {Telemetry::RECORD_MAGIC, Telemetry::RECORD_FORMAT_VERSION,
+                                         2,    0,          // Record count
+                                         8,    0,          // Payload length
+                                         0xE8, 0x03, 0, 0, // Base timestamp
+                                         1,    0, 0x96, 0x08,  // Sensor, no delay, +523
+                                         1,    0xD0, 0x0F, 0x05}; // Sensor, +1000 ms, -3
+  EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + encoder.getLength()), expected)
+      << "Batch must match the format"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordFormatTest, IsRejectingReadingWhichDoesNotFit) { // NOLINT
+  std::array<uint8_t, Telemetry::RECORD_HEADER_SIZE + 3> buffer = {};
+  Telemetry::RecordEncoder encoder(buffer.data(), buffer.size());
+  EXPECT_TRUE(encoder.append(0, TIMESTAMP, 1)) << "Small reading must fit";         // NOLINT
+  EXPECT_FALSE(encoder.append(0, TIMESTAMP, 2)) << "Full batch must reject";        // NOLINT
+  EXPECT_EQ(encoder.getRecordCount(), 1) << "Rejected reading must not be counted"; // NOLINT
+  EXPECT_EQ(encoder.getLength(), buffer.size()) << "Batch must be unchanged";       // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordFormatTest, IsStartingOverAfterClear) { // NOLINT
+  std::array<uint8_t, Telemetry::RECORD_HEADER_SIZE + Telemetry::MAX_RECORD_SIZE> buffer = {};
+  Telemetry::RecordEncoder encoder(buffer.data(), buffer.size());
+  encoder.append(0, TIMESTAMP, 100);
+  encoder.clear();
+  EXPECT_EQ(encoder.getRecordCount(), 0) << "Cleared batch must be empty";                    // NOLINT
+  EXPECT_EQ(encoder.getLength(), Telemetry::RECORD_HEADER_SIZE) << "Only the header remains"; // NOLINT
+  encoder.append(0, 2 * TIMESTAMP, 100);
+  encoder.finish();
+  EXPECT_EQ(buffer[Telemetry::RECORD_TIMESTAMP_OFFSET], 0xD0) << "New batch must get a new base";        // NOLINT
+  EXPECT_EQ(buffer[Telemetry::RECORD_HEADER_SIZE + 2], 200) << "Value must not depend on the old batch"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordFormatTest, IsSendingUntrackedValuesAsIs) { // NOLINT
+  std::array<uint8_t, Telemetry::RECORD_HEADER_SIZE + 2 * Telemetry::MAX_RECORD_SIZE> buffer = {};
+  Telemetry::RecordEncoder encoder(buffer.data(), buffer.size());
+  encoder.append(UNTRACKED_SENSOR_ID, TIMESTAMP, 5);
+  encoder.append(UNTRACKED_SENSOR_ID, TIMESTAMP, 5);
+  EXPECT_EQ(buffer[Telemetry::RECORD_HEADER_SIZE + 2], 10) << "Value must be sent as is";       // NOLINT
+  EXPECT_EQ(buffer[Telemetry::RECORD_HEADER_SIZE + 5], 10) << "Value must be sent as is again"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RecordFormatTest, IsBoundingBatchToHeaderField) { // NOLINT
+  std::vector<uint8_t> buffer(Telemetry::MAX_RECORD_BATCH_SIZE + Telemetry::MAX_RECORD_SIZE);
+  Telemetry::RecordEncoder encoder(buffer.data(), buffer.size());
+  while (encoder.append(0, TIMESTAMP, 0)) {
+  }
+  EXPECT_EQ(encoder.getLength(), Telemetry::MAX_RECORD_BATCH_SIZE) << "Batch must stop at the field limit"; // NOLINT
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <gtest/gtest.h>
+#include <telemetry/loopback/loopback.hpp>
+#include <telemetry/record-decoder/record-decoder.hpp>
+#include <telemetry/uplink/uplink.hpp>
+#include <vector>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t SAMPLE_PERIOD = 1000;
+
+const uint32_t HOUR = 3600000;
+
+/*
+ * Transport which is ready but fails every send while failing is set, like a
+ * server answering with an error
+ */
+class FailingTransport : public Telemetry::Transport {
+public:
+  bool failing = true;
+  uint32_t sendCalls = 0;
+
+  auto isReady() -> bool override { return true; }
+  auto send(const uint8_t * /*batch*/, size_t /*length*/) -> bool override {
+    ++this->sendCalls;
+    return !this->failing;
+  }
+};
+
+/*
+ * Receive the next batch of the transport and decode its readings
+ */
+auto receiveRecords(Telemetry::LoopbackTransport &transport) -> std::vector<Telemetry::Record> {
+  std::vector<uint8_t> batch;
+  transport.receive(batch);
+  Telemetry::RecordDecoder decoder;
+  std::vector<Telemetry::Record> records;
+  Telemetry::Record record = {};
+  size_t offset = 0;
+  size_t consumed = 0;
+  while (decoder.next(batch.data() + offset, batch.size() - offset, record, consumed) == Telemetry::DECODE_RECORD) {
+    records.push_back(record);
+    offset += consumed;
+  }
+  return records;
+}
+
+/*
+ * Record readings one period apart until a batch is sent, returning the number
+ * of readings recorded
+ */
+auto recordUntilSent(Telemetry::Uplink &uplink, uint32_t &timestamp) -> uint32_t {
+  const uint32_t sentBatches = uplink.getSentBatches();
+  uint32_t recorded = 0;
+  while (uplink.getSentBatches() == sentBatches) {
+    uplink.record(0, timestamp, -1);
+    timestamp += 1;
+    ++recorded;
+  }
+  return recorded;
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(UplinkTest, IsFormattingReadings) { // NOLINT
+  Telemetry::LoopbackTransport transport;
+  Telemetry::Uplink uplink(transport);
+  EXPECT_TRUE(uplink.flush()) << "Empty batch must flush";                 // NOLINT
+  EXPECT_EQ(transport.getQueuedBatches(), 0) << "Empty batch is not sent"; // NOLINT
+
+  EXPECT_TRUE(uplink.record(1, SAMPLE_PERIOD, 523)) << "Reading must be batched"; // NOLINT
+  EXPECT_TRUE(uplink.record(0, SAMPLE_PERIOD, -7)) << "Reading must be batched";  // NOLINT
+  EXPECT_EQ(uplink.getPendingSamples(), 2) << "Both readings must be pending";    // NOLINT
+  EXPECT_TRUE(uplink.flush()) << "Batch must be sent";                            // NOLINT
+  const std::vector<Telemetry::Record> records = receiveRecords(transport);
+  ASSERT_EQ(records.size(), 2) << "Batch must hold both readings";            // NOLINT
+  EXPECT_EQ(records[0].sensorId, 1) << "Sensor must be kept";                 // NOLINT
+  EXPECT_EQ(records[0].timestamp, SAMPLE_PERIOD) << "Timestamp must be kept"; // NOLINT
+  EXPECT_EQ(records[0].value, 523) << "Value must be kept";                   // NOLINT
+  EXPECT_EQ(records[1].sensorId, 0) << "Sensor must be kept";                 // NOLINT
+  EXPECT_EQ(records[1].value, -7) << "Value must be kept";                    // NOLINT
+  EXPECT_EQ(uplink.getPendingSamples(), 0) << "Sent batch must be cleared";   // NOLINT
+  EXPECT_EQ(uplink.getSentBatches(), 1) << "Sent batch must be counted";      // NOLINT
+  EXPECT_EQ(uplink.getSentSamples(), 2) << "Sent readings must be counted";   // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(UplinkTest, IsSendingFullBatch) { // NOLINT
+  Telemetry::LoopbackTransport transport;
+  Telemetry::Uplink uplink(transport);
+  uint32_t timestamp = SAMPLE_PERIOD;
+  const uint32_t recorded = recordUntilSent(uplink, timestamp);
+  EXPECT_EQ(transport.getQueuedBatches(), 1) << "Full batch must be sent with one write";        // NOLINT
+  EXPECT_EQ(uplink.getSentSamples(), recorded - 1) << "Reading which did not fit must wait";     // NOLINT
+  EXPECT_EQ(uplink.getPendingSamples(), 1) << "Reading which did not fit starts the next batch"; // NOLINT
+
+  EXPECT_LE(transport.getReceivedBytes(), Telemetry::TELEMETRY_BATCH_SIZE) << "Batch must fit the size bound"; // NOLINT
+  EXPECT_EQ(receiveRecords(transport).size(), recorded - 1) << "Batch must hold every sent reading";           // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(UplinkTest, IsSendingOldBatch) { // NOLINT
+  Telemetry::LoopbackTransport transport;
+  Telemetry::Uplink uplink(transport);
+  uint32_t timestamp = SAMPLE_PERIOD;
+  for (; timestamp < Telemetry::TELEMETRY_BATCH_AGE; timestamp += SAMPLE_PERIOD) {
+    uplink.record(0, timestamp, 1);
+  }
+  EXPECT_EQ(uplink.getSentBatches(), 0) << "Young batch must be kept"; // NOLINT
+  uplink.record(0, timestamp + SAMPLE_PERIOD, 1);
+  EXPECT_EQ(uplink.getSentBatches(), 1) << "Old batch must be sent";                    // NOLINT
+  EXPECT_EQ(uplink.getSentSamples(), 29) << "Old batch must hold the earlier readings"; // NOLINT
+  EXPECT_EQ(uplink.getPendingSamples(), 1) << "New reading starts the next batch";      // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(UplinkTest, IsDroppingUnderBackpressure) { // NOLINT
+  Telemetry::LoopbackTransport transport(1);
+  Telemetry::Uplink uplink(transport);
+  uint32_t timestamp = SAMPLE_PERIOD;
+  recordUntilSent(uplink, timestamp);
+  const uint16_t pendingSamples = uplink.getPendingSamples();
+  while (uplink.record(0, timestamp, -1)) {
+    timestamp += 1;
+  }
+  EXPECT_EQ(uplink.getDroppedSamples(), 1) << "Reading which does not fit must be dropped"; // NOLINT
+  EXPECT_GT(uplink.getPendingSamples(), pendingSamples) << "Batch must be kept";            // NOLINT
+  EXPECT_FALSE(uplink.flush()) << "Batch must not be sent while the server is busy";        // NOLINT
+
+  receiveRecords(transport);
+  EXPECT_TRUE(uplink.flush()) << "Batch must be sent once the server has room"; // NOLINT
+  EXPECT_EQ(uplink.getSentBatches(), 2) << "Both batches must be sent";         // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(UplinkTest, IsKeepingBatchOnFailedSend) { // NOLINT
+  Telemetry::LoopbackTransport transport;
+  Telemetry::Uplink uplink(transport);
+  uplink.record(0, SAMPLE_PERIOD, 1);
+  transport.setConnected(false);
+  EXPECT_FALSE(uplink.flush()) << "Batch must not be sent while disconnected"; // NOLINT
+  EXPECT_EQ(uplink.getPendingSamples(), 1) << "Batch must be kept";            // NOLINT
+
+  FailingTransport failingTransport;
+  Telemetry::Uplink failingUplink(failingTransport);
+  failingUplink.record(0, SAMPLE_PERIOD, 1);
+  EXPECT_FALSE(failingUplink.flush()) << "Batch must not be sent on a failed write"; // NOLINT
+  EXPECT_EQ(failingUplink.getPendingSamples(), 1) << "Batch must be kept";           // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(UplinkTest, IsBackingOffAfterFailedSend) { // NOLINT
+  FailingTransport transport;
+  Telemetry::Uplink uplink(transport);
+  uint32_t timestamp = SAMPLE_PERIOD;
+  for (; timestamp <= HOUR; timestamp += SAMPLE_PERIOD) {
+    uplink.record(0, timestamp, 1);
+  }
+  // The first send is due at the batch age, the retries after delays of 1 s
+  // to 256 s, then every 300 s
+  EXPECT_EQ(transport.sendCalls, 20) << "Failed sends must back off";                                // NOLINT
+  EXPECT_EQ(uplink.getRetryDelay(), Telemetry::TELEMETRY_RETRY_DELAY_MAX) << "Delay must be capped"; // NOLINT
+  EXPECT_GT(uplink.getDroppedSamples(), 0) << "Readings must be dropped while backing off";          // NOLINT
+
+  transport.failing = false;
+  uplink.record(0, timestamp + Telemetry::TELEMETRY_RETRY_DELAY_MAX, 1);
+  EXPECT_EQ(uplink.getSentBatches(), 1) << "Batch must be sent once the delay has passed"; // NOLINT
+  EXPECT_EQ(uplink.getRetryDelay(), 0) << "Sent batch must end the back off";              // NOLINT
+}
+
+} // namespace
+
+#endif
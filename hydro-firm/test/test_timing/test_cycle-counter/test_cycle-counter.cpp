@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <timing/cycle-counter/cycle-counter.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t NANOSECONDS_PER_MILLISECOND = 1000000;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(CycleCounterTest, IsCountingNanoseconds) { // NOLINT
+  const uint32_t start = Timing::readCycleCounter();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_GE(Timing::readCycleCounter() - start, NANOSECONDS_PER_MILLISECOND) << "Counter must run in ns"; // NOLINT
+  EXPECT_STREQ(Timing::CYCLE_COUNTER_UNIT, "ns") << "Unit must be reported";                              // NOLINT
+}
+
+} // namespace
+
+#endif
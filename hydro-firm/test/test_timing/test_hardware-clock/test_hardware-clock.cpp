@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <ArduinoFake.h>
+#include <gtest/gtest.h>
+#include <timing/hardware-clock/hardware-clock.hpp>
+
+#ifdef NATIVE
+
+namespace {
+using namespace fakeit; // NOLINT(google-build-using-namespace)
+
+const uint32_t NOW = 4321;
+const uint32_t DELAY = 25;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HardwareClockTest, IsUsingTheArduinoCore) { // NOLINT
+  ArduinoFakeReset();
+  When(Method(ArduinoFake(), millis)).AlwaysReturn(NOW);
+  When(Method(ArduinoFake(), delay)).AlwaysReturn();
+  When(Method(ArduinoFake(), delayMicroseconds)).AlwaysReturn();
+  Timing::Clock &clock = Timing::getHardwareClock();
+  EXPECT_EQ(clock.millis(), NOW) << "Time must come from millis()"; // NOLINT
+  clock.delay(DELAY);
+  Verify(Method(ArduinoFake(), delay).Using(DELAY)).Once();
+  clock.delayMicroseconds(DELAY);
+  Verify(Method(ArduinoFake(), delayMicroseconds).Using(DELAY)).Once();
+  EXPECT_EQ(&Timing::getHardwareClock(), &clock) << "Hardware clock must be shared"; // NOLINT
+}
+
+} // namespace
+
+#endif
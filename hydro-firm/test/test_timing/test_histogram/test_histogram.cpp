@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+#include <timing/histogram/histogram.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HistogramTest, AreBucketsPowersOfTwo) {                                                             // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketIndex(0), 0) << "Zero has its own bucket";                       // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketIndex(1), 1) << "One starts the first power of two bucket";      // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketIndex(3), 2) << "Three ends the second bucket";                  // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketIndex(4), 3) << "Four starts the third bucket";                  // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketIndex(UINT32_MAX), 32) << "Largest value is in the last bucket"; // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketLimit(0), 0) << "Zero bucket holds only zero";                   // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketLimit(3), 7) << "Third bucket ends at seven";                    // NOLINT
+  EXPECT_EQ(Timing::Histogram::getBucketLimit(32), UINT32_MAX) << "Last bucket ends at the maximum";     // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HistogramTest, IsTrackingCountMaximumAndPercentiles) { // NOLINT
+  Timing::Histogram histogram;
+  EXPECT_EQ(histogram.getPercentile(99), 0) << "Empty histogram has no percentile"; // NOLINT
+  for (int sample = 0; sample < 98; ++sample) {
+    histogram.record(10);
+  }
+  histogram.record(300);
+  histogram.record(1000);
+  EXPECT_EQ(histogram.getCount(), 100) << "Every duration must be counted";                // NOLINT
+  EXPECT_EQ(histogram.getMaximum(), 1000) << "Maximum must be tracked";                    // NOLINT
+  EXPECT_EQ(histogram.getBucket(4), 98) << "Tens go to the 8 - 15 bucket";                 // NOLINT
+  EXPECT_EQ(histogram.getPercentile(50), 15) << "Median bound is the bucket limit";        // NOLINT
+  EXPECT_EQ(histogram.getPercentile(99), 511) << "p99 bound must cover the 99th duration"; // NOLINT
+  EXPECT_EQ(histogram.getPercentile(100), 1000) << "p100 is the maximum";                  // NOLINT
+
+  histogram.reset();
+  EXPECT_EQ(histogram.getCount(), 0) << "Reset must clear the count";     // NOLINT
+  EXPECT_EQ(histogram.getMaximum(), 0) << "Reset must clear the maximum"; // NOLINT
+  EXPECT_EQ(histogram.getBucket(4), 0) << "Reset must clear the buckets"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(HistogramTest, IsFormattingASummaryLine) { // NOLINT
+  Timing::Histogram histogram;
+  histogram.record(0);
+  histogram.record(5);
+  histogram.record(6);
+  std::array<char, 128> line = {};
+  const int length = histogram.format(line.data(), line.size());
+  const std::string expected = "count=3 p50=6 p99=6 max=6 <=0:1 <=7:2";
+  EXPECT_EQ(std::string(line.data()), expected) << "Summary must list the non empty buckets";    // NOLINT
+  EXPECT_EQ(length, static_cast<int>(expected.size())) << "Length of the line must be returned"; // NOLINT
+
+  std::array<char, 16> shortLine = {};
+  EXPECT_EQ(histogram.format(shortLine.data(), shortLine.size()), length) << "Full length must be returned"; // NOLINT
+  EXPECT_EQ(std::string(shortLine.data()), expected.substr(0, shortLine.size() - 1)) << "Line must be cut";  // NOLINT
+  EXPECT_EQ(histogram.format(nullptr, 0), length) << "Length must be measurable without a buffer";           // NOLINT
+}
+
+} // namespace
+
+#endif
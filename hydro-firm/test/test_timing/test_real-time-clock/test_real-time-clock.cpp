@@ -0,0 +1,59 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <gtest/gtest.h>
+#include <timing/real-time-clock/real-time-clock.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t DELAY = 20;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RealTimeClockTest, IsSleepingForTheDelay) { // NOLINT
+  Timing::RealTimeClock clock;
+  const uint32_t start = clock.millis();
+  EXPECT_LT(start, DELAY) << "Clock must start near zero"; // NOLINT
+  clock.delay(DELAY);
+  EXPECT_GE(clock.millis() - start, DELAY) << "Delay must let the time pass"; // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(RealTimeClockTest, IsSleepingForTheMicrosecondDelay) { // NOLINT
+  Timing::RealTimeClock clock;
+  const uint32_t start = clock.millis();
+  clock.delayMicroseconds(DELAY * 1000);
+  EXPECT_GE(clock.millis() - start, DELAY) << "Delay must let the time pass"; // NOLINT
+}
+
+} // namespace
+
+#endif
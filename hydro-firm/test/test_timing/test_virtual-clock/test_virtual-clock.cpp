@@ -0,0 +1,75 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 ARUN C S
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * @author: Arun C S
+ * @email: aruncs009@gmail.com
+ * @since: 17-10-2026
+ */
+
+#include <gtest/gtest.h>
+#include <timing/virtual-clock/virtual-clock.hpp>
+
+#ifdef NATIVE
+
+namespace {
+
+const uint32_t START = 1000;
+const uint32_t DAY = 86400000;
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(VirtualClockTest, IsMovingOnlyWhenTold) { // NOLINT
+  Timing::VirtualClock clock(START);
+  EXPECT_EQ(clock.millis(), START) << "Clock must start at the given time"; // NOLINT
+  clock.advance(DAY);
+  EXPECT_EQ(clock.millis(), START + DAY) << "Clock must advance";       // NOLINT
+  EXPECT_EQ(clock.getDelayedMillis(), 0) << "Advancing is not a delay"; // NOLINT
+  clock.delay(DAY);
+  EXPECT_EQ(clock.millis(), START + 2 * DAY) << "Delay must jump to its end"; // NOLINT
+  EXPECT_EQ(clock.getDelayedMillis(), DAY) << "Delay must be counted";        // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(VirtualClockTest, IsCarryingMicroseconds) { // NOLINT
+  Timing::VirtualClock clock(START);
+  clock.delayMicroseconds(600);
+  EXPECT_EQ(clock.millis(), START) << "Part of a millisecond must not advance the clock"; // NOLINT
+  clock.delayMicroseconds(600);
+  EXPECT_EQ(clock.millis(), START + 1) << "Carried microseconds must advance the clock"; // NOLINT
+  clock.delayMicroseconds(2 * Timing::MICROS_PER_MILLI);
+  EXPECT_EQ(clock.millis(), START + 3) << "Whole milliseconds must advance the clock"; // NOLINT
+  EXPECT_EQ(clock.getDelayedMicros(), 3200) << "Microsecond delays must be counted";   // NOLINT
+  EXPECT_EQ(clock.getDelayedMillis(), 0) << "Millisecond delays are counted apart";    // NOLINT
+}
+
+// cppcheck-suppress [syntaxError,unmatchedSuppression]
+TEST(VirtualClockTest, IsWrappingAroundLikeMillis) { // NOLINT
+  Timing::VirtualClock clock(UINT32_MAX);
+  clock.delay(2);
+  EXPECT_EQ(clock.millis(), 1) << "Clock must wrap around"; // NOLINT
+}
+
+} // namespace
+
+#endif